@@ -0,0 +1,167 @@
+// Self-contained fuzzing driver for toolchains without libFuzzer (make fuzz).
+// Keeps every input that reaches a new guest branch outcome, or a new hit-count
+// class of one, and mutates the corpus with byte flips, arithmetic, inserts,
+// erases and duplicated slices.
+// Fuzzing stops at the first crash, which is written to crash-0; replayed
+// seed inputs that crash are written to crash-N in order.
+//   bin/fuzz [--runs N] [--seed S] [--max-cycles N] <firmware.bin> [seed inputs...]
+// With --runs 0 the seed inputs are only replayed (crash reproduction).
+#include "FuzzHarness.hpp"
+#include "CommandLine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using Input = std::vector<uint8_t>;
+
+static constexpr uint32_t MAP_SIZE = 1 << 16;
+
+static bool read_input(const std::string& path, Input& input) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    input.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// AFL-style hit-count classes, so a loop running longer also counts as progress
+static uint8_t hit_bucket(uint8_t count) {
+    if (count == 0) return 0;
+    if (count <= 3) return 1 << (count - 1);
+    if (count <= 7) return 1 << 3;
+    if (count <= 15) return 1 << 4;
+    if (count <= 31) return 1 << 5;
+    if (count <= 127) return 1 << 6;
+    return 1 << 7;
+}
+
+static void mutate(Input& input, std::mt19937& rng, uint32_t max_size) {
+    uint32_t count = 1 + rng() % 4;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t pos = input.empty() ? 0 : rng() % input.size();
+        switch (rng() % 6) {
+            case 0: if (!input.empty()) input[pos] ^= 1 << (rng() % 8); break;
+            case 1: if (!input.empty()) input[pos] = rng(); break;
+            case 2: if (input.size() < max_size) input.insert(input.begin() + pos, (uint8_t)rng()); break;
+            case 3: if (!input.empty()) input.erase(input.begin() + pos); break;
+            case 4: if (!input.empty()) input[pos] += 1 + rng() % 35 - 17; break; // Small arithmetic
+            case 5: { // Duplicate a slice, which grows records quickly
+                uint32_t length = std::min<uint32_t>(input.size() - pos, 1 + rng() % 16);
+                if (input.size() + length > max_size) break;
+                Input slice(input.begin() + pos, input.begin() + pos + length);
+                input.insert(input.begin() + rng() % (input.size() + 1), slice.begin(), slice.end());
+                break;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t runs = 100000;
+    uint32_t seed = 1;
+    uint64_t max_cycles = 1000000;
+    std::vector<std::string> files;
+    bool usage_error = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) {
+            if (!parse_number(argv[++i], runs)) usage_error = true;
+        } else if (arg == "--seed" && i + 1 < argc) {
+            if (!parse_number(argv[++i], seed)) usage_error = true;
+        } else if (arg == "--max-cycles" && i + 1 < argc) {
+            if (!parse_number(argv[++i], max_cycles)) usage_error = true;
+        } else {
+            files.push_back(arg);
+        }
+    }
+    if (usage_error || files.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--runs N] [--seed S] [--max-cycles N]"
+                  << " <firmware.bin> [seed inputs...]" << std::endl;
+        return 1;
+    }
+
+    std::vector<uint32_t> firmware;
+    if (!FuzzHarness::read_firmware(files[0], firmware)) {
+        std::cerr << "Error: Could not read firmware " << files[0] << std::endl;
+        return 1;
+    }
+    FuzzHarness harness(firmware, FuzzHarness::DEFAULT_INPUT_ADDR, FuzzHarness::DEFAULT_INPUT_MAX, max_cycles);
+    std::vector<uint8_t> map(MAP_SIZE), seen(MAP_SIZE);
+    harness.set_coverage_map(map.data(), MAP_SIZE);
+
+    uint32_t edges = 0, features = 0, crashes = 0, timeouts = 0;
+    std::vector<Input> corpus;
+    // Runs one input; returns true if it reached a branch outcome or hit count not seen before
+    auto execute = [&](const Input& input) {
+        std::fill(map.begin(), map.end(), 0);
+        FuzzHarness::Outcome outcome = harness.run(input.data(), input.size());
+        bool fresh = false;
+        // Only a handful of counters are hit per run, so skip zero words
+        for (uint32_t w = 0; w < MAP_SIZE; w += 8) {
+            uint64_t word;
+            std::memcpy(&word, &map[w], sizeof(word));
+            if (!word) continue;
+            for (uint32_t i = w; i < w + 8; ++i) {
+                uint8_t bucket = hit_bucket(map[i]);
+                if (bucket & ~seen[i]) {
+                    if (!seen[i]) edges++;
+                    seen[i] |= bucket;
+                    features++;
+                    fresh = true;
+                }
+            }
+        }
+        if (outcome == FuzzHarness::Outcome::Timeout) timeouts++;
+        if (outcome == FuzzHarness::Outcome::Crash) {
+            std::string name = "crash-" + std::to_string(crashes++);
+            std::ofstream(name, std::ios::binary).write(reinterpret_cast<const char*>(input.data()), input.size());
+            std::cout << "Crash (" << input.size() << " bytes) written to " << name << std::endl;
+        }
+        return fresh;
+    };
+
+    for (size_t i = 1; i < files.size(); ++i) {
+        Input input;
+        if (!read_input(files[i], input)) {
+            std::cerr << "Error: Could not read input " << files[i] << std::endl;
+            return 1;
+        }
+        execute(input);
+        corpus.push_back(input);
+    }
+    if (corpus.empty()) {
+        execute({});
+        corpus.push_back({});
+    }
+
+    std::mt19937 rng(seed);
+    auto start = std::chrono::steady_clock::now();
+    auto report = [&](const char* tag) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        double rate = elapsed.count() > 0 ? harness.get_execs() / elapsed.count() : 0;
+        std::cout << "#" << harness.get_execs() << " " << tag << " edges: " << edges << " features: " << features << " corpus: " << corpus.size()
+                  << " crashes: " << crashes << " timeouts: " << timeouts << " exec/s: " << (uint64_t)rate << std::endl;
+    };
+
+    for (uint64_t n = 1; n <= runs; ++n) {
+        Input input = corpus[rng() % corpus.size()];
+        mutate(input, rng, FuzzHarness::DEFAULT_INPUT_MAX);
+        if (execute(input)) {
+            corpus.push_back(input);
+            report("NEW");
+        }
+        if (crashes) {
+            break; // Like libFuzzer, stop at the first crash
+        }
+        if ((n & (n - 1)) == 0 && n >= 1024) {
+            report("pulse");
+        }
+    }
+    report("DONE");
+    return crashes ? 1 : 0;
+}
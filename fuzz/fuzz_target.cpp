@@ -0,0 +1,41 @@
+// libFuzzer entry point. Build with `make fuzz-libfuzzer` (needs clang) and run:
+//   FUZZ_FIRMWARE=examples/fuzz_parser.bin bin/fuzz-libfuzzer corpus/
+// Optional: FUZZ_INPUT_ADDR, FUZZ_INPUT_MAX, FUZZ_MAX_CYCLES.
+#include "FuzzHarness.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+// Guest branch coverage, reported to libFuzzer next to its own instrumentation
+extern "C" __attribute__((section("__libfuzzer_extra_counters")))
+uint8_t guest_branch_counters[1 << 16];
+
+static std::unique_ptr<FuzzHarness> harness;
+
+static uint64_t env_or(const char* name, uint64_t fallback) {
+    const char* value = std::getenv(name);
+    return value ? std::strtoull(value, nullptr, 0) : fallback;
+}
+
+extern "C" int LLVMFuzzerInitialize(int*, char***) {
+    const char* path = std::getenv("FUZZ_FIRMWARE");
+    std::vector<uint32_t> firmware;
+    if (!path || !FuzzHarness::read_firmware(path, firmware)) {
+        std::fprintf(stderr, "Error: FUZZ_FIRMWARE must name a readable firmware image\n");
+        std::exit(1);
+    }
+    harness = std::make_unique<FuzzHarness>(firmware,
+        env_or("FUZZ_INPUT_ADDR", FuzzHarness::DEFAULT_INPUT_ADDR),
+        env_or("FUZZ_INPUT_MAX", FuzzHarness::DEFAULT_INPUT_MAX),
+        env_or("FUZZ_MAX_CYCLES", 1000000));
+    harness->set_coverage_map(guest_branch_counters, sizeof(guest_branch_counters));
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (harness->run(data, size) == FuzzHarness::Outcome::Crash) {
+        std::fprintf(stderr, "Guest crash, stopped at pc 0x%08x\n", harness->get_cpu().fetch_pc());
+        std::abort();
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+#ifndef ARCH_TEST_HPP
+#define ARCH_TEST_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Memory;
+
+// An ELF executable's entry point and symbol table
+struct ElfImage {
+    uint32_t entry = 0;
+    std::unordered_map<std::string, uint32_t> symbols;
+};
+
+// Copies the PT_LOAD segments of a 32-bit little-endian RISC-V executable
+// into RAM. Returns false with a description in error if the file is not
+// one, or a segment falls outside RAM.
+bool load_elf(const std::string& path, Memory& mem, ElfImage& image, std::string& error);
+
+// A test in the riscv-arch-test signature format: an ELF image that writes
+// its results between the begin_signature and end_signature symbols, and a
+// reference file with one hex word per line.
+struct ArchTest {
+    std::string name;
+    std::string elf_path;
+    std::string reference_path;
+};
+
+struct ArchTestResult {
+    std::string name;
+    bool passed = false;
+    std::string detail; // Why the test failed
+    uint64_t cycles = 0;
+    uint64_t instret = 0;
+};
+
+// name.elf files with a name.reference_output next to them, sorted by name.
+// path may also name a single .elf file.
+std::vector<ArchTest> find_arch_tests(const std::string& path);
+
+// Runs one test on its own core and RAM until it halts (M-mode ECALL with
+// mtvec clear) or max_cycles pass, then compares the signature.
+ArchTestResult run_arch_test(const ArchTest& test, uint64_t max_cycles);
+
+// Spreads the tests over threads; results keep the order of tests
+std::vector<ArchTestResult> run_arch_tests(const std::vector<ArchTest>& tests, unsigned threads, uint64_t max_cycles);
+
+#endif // ARCH_TEST_HPP
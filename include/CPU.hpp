@@ -3,36 +3,53 @@
 
 #include <cstdint>
 #include <array>
+#include <atomic>
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <functional>
 #include "Cache.hpp"
+#include "Tlb.hpp"
+#include "Energy.hpp"
+#include "HpmCounters.hpp"
+#include "VectorUnit.hpp"
+#include "StoreBuffer.hpp"
+#include "CoreConfig.hpp"
 
 class Memory; // Forward declaration
+class StateWriter;
+class StateReader;
+class MemTraceWriter;
 
 // Control signals for the pipeline
 struct ControlUnit {
+    static constexpr int ALU_OP_GROUPS = 12;
+
     bool reg_write = false;
     bool mem_read = false;
     bool mem_write = false;
     bool branch = false;
     bool jump = false;
     bool halt = false;
-    uint8_t alu_op = 0; // Opcode group: 0:LUI, 1:AUIPC, 2:JAL, 3:JALR, 4:BRANCH, 5:LOAD, 6:STORE, 7:OP-IMM, 8:OP, 9:SYSTEM
+    bool ecall = false; // ECALL serviced by the host handler at write-back
+    uint8_t alu_op = 0; // Opcode group: 0:LUI, 1:AUIPC, 2:JAL, 3:JALR, 4:BRANCH, 5:LOAD, 6:STORE, 7:OP-IMM, 8:OP, 9:SYSTEM, 10:VECTOR, 11:MISC-MEM
     uint8_t funct3 = 0;
     uint8_t funct7 = 0;
     bool alu_src = false; // false: reg, true: immediate
 };
+static_assert(EnergyCounters::ALU_OPS == ControlUnit::ALU_OP_GROUPS, "one energy counter per alu_op group");
 
 // Pipeline Registers
 struct IF_ID_Reg {
     uint32_t instruction = 0;
     uint32_t pc = 0;
+    bool fetch_fault = false; // Instruction page fault, raised when it reaches EX
     bool valid = false;
 };
 
 struct ID_EX_Reg {
     uint32_t pc = 0;
+    uint32_t instruction = 0;
     uint32_t reg_val1 = 0;
     uint32_t reg_val2 = 0;
     int32_t imm = 0;
@@ -40,10 +57,13 @@ struct ID_EX_Reg {
     uint8_t rs2 = 0;
     uint8_t rd = 0;
     ControlUnit controls;
+    bool fetch_fault = false;
     bool valid = false;
 };
 
 struct EX_MEM_Reg {
+    uint32_t pc = 0;
+    uint32_t instruction = 0;
     uint32_t alu_result = 0;
     uint32_t reg_val2 = 0; // Value to store
     uint8_t rd = 0;
@@ -52,39 +72,186 @@ struct EX_MEM_Reg {
 };
 
 struct MEM_WB_Reg {
+    uint32_t pc = 0;
+    uint32_t instruction = 0;
     uint32_t mem_data = 0;
     uint32_t alu_result = 0;
+    uint32_t store_data = 0;
     uint8_t rd = 0;
     ControlUnit controls;
     bool valid = false;
 };
 
-class CPU {
+// Why a run()/run_until()/step_instructions() call returned
+enum class StopReason {
+    None,
+    CycleLimit,   // The cycle budget ran out
+    Halted,       // The guest executed its halt ECALL
+    PcReached,    // run_until() target is the next instruction
+    StepDone,     // step_instructions() retired the requested count
+    FetchLimit,   // Fetch ran past the limit set with set_fetch_limit()
+    Breakpoint,   // EBREAK with a debugger attached
+    Watchpoint,   // A Memory watchpoint fired
+    HostRequest   // A callback called request_stop()
+};
+
+// Architectural effects of one retired instruction
+struct RetireInfo {
+    uint32_t pc = 0;
+    uint32_t instruction = 0;
+    uint8_t rd = 0;          // 0 if no register was written
+    uint32_t rd_value = 0;
+    uint8_t store_size = 0;  // 0 if not a store
+    uint32_t store_addr = 0;
+    uint32_t store_value = 0;
+};
+
+// The pipeline, specialized at compile time on a configuration from
+// CoreConfig.hpp. Instantiations live in CPU.cpp (see FOR_EACH_CORE_CONFIG).
+template <typename Config>
+class BasicCPU {
 public:
-    CPU(Memory& memory);
+    using EcallHandler = std::function<void(BasicCPU&)>;
+    using RetireObserver = std::function<void(const RetireInfo&)>;
+    using DevicePoll = std::function<void()>;
+
+    BasicCPU(Memory& memory);
 
     // CSR Addresses
     static constexpr uint32_t CSR_MSTATUS = 0x300, CSR_MTVEC = 0x305, CSR_MEPC = 0x341;
     static constexpr uint32_t CSR_MCAUSE  = 0x342, CSR_MTVAL = 0x343, CSR_MIE = 0x304;
     static constexpr uint32_t CSR_MIP = 0x344, CSR_MCYCLE = 0xB00, CSR_MINSTRET = 0xB02;
+    static constexpr uint32_t CSR_MEDELEG = 0x302, CSR_MIDELEG = 0x303;
+    static constexpr uint32_t CSR_SSTATUS = 0x100, CSR_SIE = 0x104, CSR_STVEC = 0x105, CSR_SEPC = 0x141;
+    static constexpr uint32_t CSR_SCAUSE = 0x142, CSR_STVAL = 0x143, CSR_SIP = 0x144, CSR_SATP = 0x180;
+    static constexpr uint32_t CSR_MCOUNTEREN = 0x306, CSR_SCOUNTEREN = 0x106, CSR_MCOUNTINHIBIT = 0x320;
+    static constexpr uint32_t CSR_MHPMEVENT3 = 0x323, CSR_MHPMCOUNTER3 = 0xB03, CSR_MCYCLEH = 0xB80;
+    static constexpr uint32_t CSR_MINSTRETH = 0xB82, CSR_CYCLE = 0xC00, CSR_INSTRET = 0xC02;
+    static constexpr uint32_t CSR_HPMCOUNTER3 = 0xC03, CSR_SCOUNTOVF = 0xDA0, CSR_MHPMEVENTH3 = 0x723;
+    static constexpr uint32_t CSR_VSTART = 0x008, CSR_VL = 0xC20, CSR_VTYPE = 0xC21, CSR_VLENB = 0xC22;
+
+    // mstatus fields (sstatus is the SSTATUS_MASK view of it)
+    static constexpr uint32_t MSTATUS_SIE = 1 << 1, MSTATUS_MIE = 1 << 3, MSTATUS_SPIE = 1 << 5;
+    static constexpr uint32_t MSTATUS_MPIE = 1 << 7, MSTATUS_SPP = 1 << 8, MSTATUS_MPP = 3 << 11;
+    static constexpr uint32_t MSTATUS_MPRV = 1 << 17, MSTATUS_SUM = 1 << 18, MSTATUS_MXR = 1 << 19;
+    static constexpr uint32_t SSTATUS_MASK = MSTATUS_SIE | MSTATUS_SPIE | MSTATUS_SPP | MSTATUS_SUM | MSTATUS_MXR;
+    static constexpr uint32_t SATP_MODE_SV32 = 1u << 31;
 
+    // mip/mie bits
+    static constexpr uint32_t MIP_SSIP = 1 << 1, MIP_MSIP = 1 << 3, MIP_STIP = 1 << 5;
+    static constexpr uint32_t MIP_MTIP = 1 << 7, MIP_SEIP = 1 << 9, MIP_MEIP = 1 << 11;
+    static constexpr uint32_t MIP_LCOFIP = 1 << 13; // Counter overflow (Sscofpmf)
+    static constexpr uint32_t MIP_WRITABLE = MIP_SSIP | MIP_STIP | MIP_SEIP | MIP_LCOFIP;
+    static constexpr uint32_t IRQ_DEVICE_POLL = 1u << 31; // Not an interrupt: a request_device_poll() in irq_lines
+
+    // Privilege levels
+    static constexpr uint8_t PRIV_U = 0, PRIV_S = 1, PRIV_M = 3;
 
     // Exception Causes
+    static constexpr uint32_t CAUSE_ILLEGAL_INSTRUCTION = 2;
+    static constexpr uint32_t CAUSE_BREAKPOINT = 3;
+    static constexpr uint32_t CAUSE_LOAD_MISALIGNED = 4;
+    static constexpr uint32_t CAUSE_STORE_MISALIGNED = 6;
+    static constexpr uint32_t CAUSE_ECALL_U_MODE = 8;
+    static constexpr uint32_t CAUSE_ECALL_S_MODE = 9;
     static constexpr uint32_t CAUSE_ECALL_M_MODE = 11;
+    static constexpr uint32_t CAUSE_FETCH_PAGE_FAULT = 12;
+    static constexpr uint32_t CAUSE_LOAD_PAGE_FAULT = 13;
+    static constexpr uint32_t CAUSE_STORE_PAGE_FAULT = 15;
+    static constexpr uint32_t CAUSE_INTERRUPT = 1u << 31;
 
     void reset();
     void clock(); // Main method to advance the pipeline by one cycle
 
+    // Embedding API. The cycle loop runs inside the core; stops other than
+    // CycleLimit and Halted leave the pipeline drained at an instruction boundary.
+    StopReason run(uint64_t max_cycles);
+    StopReason run_until(uint32_t target_pc, uint64_t max_cycles);
+    StopReason step_instructions(uint64_t count);
+    void request_stop() { pending_stop = StopReason::HostRequest; }
+    void set_fetch_limit(uint32_t limit) { fetch_limit = limit; }
+
+    // Services ECALL on the host instead of halting or trapping. The handler
+    // runs at write-back, so it sees (and may update) the architectural registers.
+    void set_ecall_handler(EcallHandler handler) { ecall_handler = std::move(handler); }
+
+    // Level-triggered interrupt lines, given as mip bits (e.g. MIP_MEIP). Safe
+    // to call from device threads; pending lines are taken by the instruction in EX.
+    void set_irq(uint32_t mip_bits, bool level) {
+        if (level) irq_lines.fetch_or(mip_bits, std::memory_order_release);
+        else irq_lines.fetch_and(~mip_bits, std::memory_order_release);
+    }
+
+    // Device threads call request_device_poll(); the core then runs the poll
+    // callback on its own thread at its next interrupt check, so devices can
+    // publish results into guest memory from the thread the guest runs on and
+    // raise their line afterwards. The request rides on irq_lines, which that
+    // check reads anyway.
+    void set_device_poll(DevicePoll poll) { device_poll = std::move(poll); }
+    void request_device_poll() { irq_lines.fetch_or(IRQ_DEVICE_POLL, std::memory_order_release); }
+
+    // Only called in configurations with Config::retire_observer set
+    void set_retire_observer(RetireObserver observer) { retire_observer = std::move(observer); }
+
+    // Only used in configurations with Config::coverage set. Each conditional
+    // branch bumps one counter per (pc, outcome); size must be a power of two.
+    void set_coverage_map(uint8_t* map, uint32_t size) {
+        coverage_map = map;
+        coverage_mask = size - 1;
+    }
+
+    // Only used in configurations with Config::mem_trace set
+    void set_mem_trace(MemTraceWriter* writer) { mem_trace = writer; }
+
+    uint64_t get_cycles() const { return cycles; }
+    uint64_t get_instret() const { return instret; }
+
     // Debugging and Testing
     void dump_registers() const;
     uint32_t get_reg(int reg_num) const;
     uint32_t get_csr(uint32_t csr_addr) const;
     uint32_t fetch_pc() const { return pc; }
     bool is_halted() const { return halted; }
+    uint8_t get_privilege() const { return priv; }
+
+    // Debugger support. While a debugger is attached, EBREAK stops the core
+    // instead of trapping. The setters below require a drained pipeline.
+    void set_debug_attached(bool attached) { debug_attached = attached; }
+    void drain();            // Stop fetching and retire everything in flight
+    void resume() { draining = false; }
+    void step_instruction(); // Retire exactly one instruction, then drain
+    bool pipeline_empty() const;
+    void set_reg(int reg_num, uint32_t value);
+    void set_pc(uint32_t new_pc) { pc = new_pc; }
+
+    // Checkpointing: architectural state, counters and the data cache, taken
+    // and restored with the pipeline drained. TLBs are rebuilt on demand.
+    void save_state(StateWriter& out) const;
+    bool load_state(StateReader& in);
 
     // Cache Stats
-    uint32_t get_cache_hits() const { return dcache.get_hits(); }
-    uint32_t get_cache_misses() const { return dcache.get_misses(); }
+    uint64_t get_cache_hits() const { return dcache.get_hits(); }
+    uint64_t get_cache_misses() const { return dcache.get_misses(); }
+
+    // Address Translation Stats
+    uint64_t get_itlb_hits() const { return itlb.get_hits(); }
+    uint64_t get_itlb_misses() const { return itlb.get_misses(); }
+    uint64_t get_dtlb_hits() const { return dtlb.get_hits(); }
+    uint64_t get_dtlb_misses() const { return dtlb.get_misses(); }
+    uint64_t get_walk_cycles() const { return walk_cycles; }
+
+    // Store buffer, miss latency and misaligned access stats
+    LsuStats get_lsu_stats() const { return lsu_stats; }
+
+    // Activity counters; all zero unless Config::energy is set
+    EnergyCounters get_energy_counters() const {
+        EnergyCounters counters = energy;
+        counters.cycles = cycles;
+        counters.instret = instret;
+        counters.dcache_hits = dcache.get_hits();
+        counters.dcache_misses = dcache.get_misses();
+        return counters;
+    }
 
 private:
     std::array<uint32_t, 32> regs;
@@ -92,10 +259,40 @@ private:
     Memory& mem;
     std::unordered_map<uint32_t, uint32_t> csrs;
 
-    Cache dcache;
+    Cache<Config::dcache_sets, Config::dcache_ways, Config::dcache_block_size> dcache;
+    Tlb<Config::tlb_entries> itlb;
+    Tlb<Config::tlb_entries> dtlb;
+
+    // Privilege and translation state. translate_fetch/translate_data cache
+    // whether Sv32 applies, so bare-mode accesses skip the MMU entirely.
+    uint8_t priv = PRIV_M;
+    bool translate_fetch = false;
+    bool translate_data = false;
+    uint64_t walk_cycles = 0;
+    uint32_t freeze = 0; // Cycles the whole pipeline stays frozen (page walks)
+    std::atomic<uint32_t> irq_lines{0};
+    uint32_t mip = 0; // Software-writable mip bits; device lines are in irq_lines
+    HpmCounters hpm;
+    std::conditional_t<Config::vector, VectorUnit<Config::vlen, Config::vector_lanes>, NoVectorUnit> vector_unit;
+    std::conditional_t<(Config::store_buffer_entries > 0), StoreBuffer<Config::store_buffer_entries>, NoStoreBuffer> store_buffer;
+    LsuStats lsu_stats;
 
     bool stall = false;
     bool halted = false;
+    bool draining = false;
+    bool debug_attached = false;
+    StopReason pending_stop = StopReason::None;
+    uint32_t fetch_limit = 0xFFFFFFFF;
+    EcallHandler ecall_handler;
+    DevicePoll device_poll;
+    RetireObserver retire_observer;
+    uint8_t* coverage_map = nullptr;
+    uint32_t coverage_mask = 0;
+    MemTraceWriter* mem_trace = nullptr;
+
+    uint64_t cycles = 0;
+    uint64_t instret = 0;
+    EnergyCounters energy; // Only counted with Config::energy
 
     // Pipeline registers
     IF_ID_Reg if_id_reg;
@@ -111,8 +308,49 @@ private:
     void wb_stage();
 
     // Private helpers
+    StopReason finish_run(StopReason reason);
+    uint32_t in_flight() const;
     void trap(uint32_t cause, uint32_t trap_pc, uint32_t tval = 0);
-    int32_t sign_extend(uint32_t value, int bits);
+    void trap_return(uint8_t from);
+    bool interrupt_pending(uint32_t& cause) const;
+    uint32_t poll_devices();
+    uint32_t csr_read(uint32_t csr_addr) const;
+    void csr_write(uint32_t csr_addr, uint32_t value);
+
+    // Performance monitoring
+    void hpm_event(uint32_t event, uint64_t amount = 1) {
+        if (hpm.event(event, priv, amount)) mip |= MIP_LCOFIP;
+    }
+    static bool is_counter_csr(uint32_t csr_addr);
+    uint32_t counter_read(uint32_t csr_addr) const;
+    void counter_write(uint32_t csr_addr, uint32_t value);
+    bool counter_enabled(uint32_t csr_addr) const;
+
+    // Load/store unit. Misaligned accesses (when not trapping) go byte by byte.
+    uint32_t load(uint32_t addr, uint32_t size);
+    void store(uint32_t addr, uint32_t value, uint32_t size);
+    void drain_store_buffer_cycle();
+    void flush_store_buffer(uint64_t& stall_stat); // Writes every buffered store now and freezes for their drain time
+
+    // Vector unit-stride and strided loads/stores; returns a trap cause or 0
+    uint32_t vector_access(uint32_t instr, uint32_t base, uint32_t stride, uint32_t& busy, uint32_t& tval);
+
+    // Address translation
+    enum class Access { Fetch, Load, Store };
+    void update_translation();
+    bool translate(uint32_t vaddr, Access access, uint32_t& paddr);
+    bool permitted(uint8_t flags, Access access) const;
+    bool page_walk(uint32_t vaddr, Access access, uint32_t& ppn, uint8_t& flags);
+    static int32_t sign_extend(uint32_t value, int bits);
+    // Bytes moved by a LOAD/STORE; EX traps the reserved funct3 values first
+    static uint32_t access_bytes(uint8_t funct3) { return 1u << (funct3 & 0x3); }
+    void trace_retire() const;
+    void notify_retire() const;
+    void record_branch(uint32_t branch_pc, bool taken) {
+        if (coverage_map) coverage_map[((branch_pc >> 1) | taken) & coverage_mask]++;
+    }
 };
 
+using CPU = BasicCPU<DefaultConfig>;
+
 #endif // CPU_HPP
@@ -2,38 +2,88 @@
 #define CACHE_HPP
 
 #include <cstdint>
-#include <vector>
-#include <iostream>
+#include <array>
 
 struct CacheLine {
     bool valid = false;
     uint32_t tag = 0;
-    std::vector<uint8_t> data;
-
-    CacheLine(uint32_t block_size) : data(block_size, 0) {}
+    uint64_t last_use = 0; // LRU timestamp within the set
 };
 
+// Set-associative cache model with LRU replacement. The geometry is fixed at
+// compile time, so address decomposition reduces to shifts and masks.
+template <uint32_t NumSets, uint32_t NumWays, uint32_t BlockSize>
 class Cache {
+    static_assert(NumSets > 0 && (NumSets & (NumSets - 1)) == 0, "NumSets must be a power of two");
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of two");
+    static_assert(NumWays > 0, "NumWays must be at least one");
+
 public:
-    Cache(uint32_t num_sets, uint32_t block_size);
+    static constexpr uint32_t SETS = NumSets;
+    static constexpr uint32_t WAYS = NumWays;
+    static constexpr uint32_t BLOCK_SIZE = BlockSize;
 
     // Returns true if hit, false if miss
     bool access(uint32_t address, bool is_write);
 
-    uint32_t get_hits() const { return hits; }
-    uint32_t get_misses() const { return misses; }
+    uint64_t get_hits() const { return hits; }
+    uint64_t get_misses() const { return misses; }
 
 private:
-    uint32_t num_sets;
-    uint32_t block_size;
-    std::vector<CacheLine> lines;
+    static constexpr uint32_t log2(uint32_t value) {
+        return value <= 1 ? 0 : 1 + log2(value >> 1);
+    }
+    static constexpr uint32_t OFFSET_BITS = log2(BlockSize);
+    static constexpr uint32_t INDEX_BITS = log2(NumSets);
+
+    std::array<CacheLine, NumSets * NumWays> lines{};
 
-    uint32_t hits = 0;
-    uint32_t misses = 0;
+    uint64_t hits = 0; // 64-bit: long runs pass 4G accesses
+    uint64_t misses = 0;
+    uint64_t use_clock = 0;
 
     // Address decomposition helpers
-    uint32_t get_tag(uint32_t address) const;
-    uint32_t get_index(uint32_t address) const;
+    static uint32_t get_index(uint32_t address) { return (address >> OFFSET_BITS) & (NumSets - 1); }
+    static uint32_t get_tag(uint32_t address) { return address >> (OFFSET_BITS + INDEX_BITS); }
 };
 
+template <uint32_t NumSets, uint32_t NumWays, uint32_t BlockSize>
+bool Cache<NumSets, NumWays, BlockSize>::access(uint32_t address, bool is_write) {
+    (void)is_write; // Currently, we don't distinguish write-through/back for simplicity
+    uint32_t tag = get_tag(address);
+    CacheLine* set = &lines[get_index(address) * NumWays];
+
+    if constexpr (NumWays == 1) {
+        if (set->valid && set->tag == tag) {
+            hits++;
+            return true;
+        }
+        misses++;
+        // Simulate a line fill
+        set->valid = true;
+        set->tag = tag;
+        return false;
+    } else {
+        use_clock++;
+        CacheLine* victim = set;
+        for (uint32_t way = 0; way < NumWays; ++way) {
+            CacheLine& line = set[way];
+            if (line.valid && line.tag == tag) {
+                line.last_use = use_clock;
+                hits++;
+                return true;
+            }
+            // Prefer an invalid way, otherwise the least recently used one
+            if (victim->valid && (!line.valid || line.last_use < victim->last_use)) {
+                victim = &line;
+            }
+        }
+        misses++;
+        victim->valid = true;
+        victim->tag = tag;
+        victim->last_use = use_clock;
+        return false;
+    }
+}
+
 #endif // CACHE_HPP
@@ -0,0 +1,66 @@
+#ifndef CACHE_SWEEP_HPP
+#define CACHE_SWEEP_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Miss counts of one set count and block size at every associativity from
+// 1 to max_ways, in a single pass (Mattson stack distances: an LRU cache of
+// W ways hits exactly the accesses found in the top W entries of their set's
+// recency stack). Matches Cache<> for the same geometry; writes allocate.
+class StackDistanceSweep {
+public:
+    StackDistanceSweep(uint32_t sets, uint32_t block_size, uint32_t max_ways);
+
+    void access(uint32_t address) {
+        uint32_t block = address >> block_shift;
+        uint32_t set = block & (sets - 1);
+        uint32_t* stack = &stacks[set * max_ways];
+        uint32_t depth = depths[set];
+        uint32_t pos = 0;
+        while (pos < depth && stack[pos] != block) pos++;
+        if (pos < depth) {
+            hits_at[pos]++;
+        } else if (depth < max_ways) {
+            depths[set]++;
+        } else {
+            pos = max_ways - 1; // Falls off the deepest cache swept
+        }
+        std::memmove(stack + 1, stack, pos * sizeof(uint32_t));
+        stack[0] = block;
+        accesses++;
+    }
+
+    uint32_t get_sets() const { return sets; }
+    uint32_t get_block_size() const { return 1u << block_shift; }
+    uint64_t get_accesses() const { return accesses; }
+    uint64_t get_misses(uint32_t ways) const;
+
+private:
+    uint32_t sets;
+    uint32_t block_shift;
+    uint32_t max_ways;
+    std::vector<uint32_t> stacks;  // max_ways block numbers per set, most recent first
+    std::vector<uint32_t> depths;  // Valid stack entries per set
+    std::vector<uint64_t> hits_at; // Hits by stack distance
+    uint64_t accesses = 0;
+};
+
+struct SweepResult {
+    uint32_t block_size;
+    uint32_t sets;
+    uint32_t ways;
+    uint64_t accesses;
+    uint64_t misses;
+};
+
+// Replays a MemTrace file through every combination of block size and set
+// count (powers of two) at 1..max_ways ways. The geometries are dealt out to
+// threads, each of which reads the trace once. Returns false with a
+// description in error if the trace cannot be read.
+bool sweep_trace(const std::string& path, const std::vector<uint32_t>& block_sizes, const std::vector<uint32_t>& set_counts,
+                 uint32_t max_ways, unsigned threads, std::vector<SweepResult>& results, std::string& error);
+
+#endif // CACHE_SWEEP_HPP
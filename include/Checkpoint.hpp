@@ -0,0 +1,123 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class Memory;
+
+// Flat little-endian serialization of trivially copyable values
+class StateWriter {
+public:
+    template <typename T>
+    void put(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "put() needs a trivially copyable type");
+        put_bytes(&value, sizeof(T));
+    }
+    void put_bytes(const void* bytes, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(bytes);
+        data.insert(data.end(), p, p + size);
+    }
+
+    std::vector<uint8_t> data;
+};
+
+class StateReader {
+public:
+    StateReader(const uint8_t* data, size_t size) : p(data), left(size) {}
+
+    // Each read fails (and keeps failing) once the input runs out
+    template <typename T>
+    bool get(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "get() needs a trivially copyable type");
+        return get_bytes(&value, sizeof(T));
+    }
+    bool get_bytes(void* bytes, size_t size) {
+        if (!ok || size > left) return ok = false;
+        std::memcpy(bytes, p, size);
+        p += size;
+        left -= size;
+        return true;
+    }
+    const uint8_t* peek() const { return p; }
+    size_t remaining() const { return left; }
+
+private:
+    const uint8_t* p;
+    size_t left;
+    bool ok = true;
+};
+
+// Incremental checkpoints of a long run. capture() copies the CPU state and
+// the RAM pages written since the previous checkpoint (Memory::DIRTY_CHECKPOINT),
+// and a background thread writes each one to <dir>/ckpt-NNNNNN.bin: written to
+// a temporary file, fsynced, renamed, then the directory fsynced, strictly in
+// order. Every FULL_EVERY-th checkpoint holds all of RAM; once it is durable
+// the older files are deleted.
+class Checkpointer {
+public:
+    static constexpr uint32_t FULL_EVERY = 32;
+
+    Checkpointer(Memory& mem, const std::string& dir, const std::string& config);
+    ~Checkpointer();
+
+    // Creates the directory if needed; false if it cannot be used
+    bool open();
+
+    // Continue numbering after a resumed checkpoint
+    void set_sequence(uint32_t last) { sequence = last; }
+
+    // cpu_state is the serialized core, taken with the pipeline drained.
+    // Blocks only if the writer is more than two checkpoints behind.
+    void capture(std::vector<uint8_t> cpu_state);
+
+    // Waits until every captured checkpoint is durable
+    void flush();
+
+    uint32_t get_count() const { return sequence - first_sequence; }
+    uint64_t get_bytes_written() const;
+    double get_capture_seconds() const { return capture_seconds; }
+
+    // Rebuilds RAM from the newest complete chain in dir (the last full
+    // checkpoint plus the consecutive ones after it). Returns false with a
+    // description in error if there is none, or it belongs to another config.
+    static bool resume(const std::string& dir, const std::string& config, Memory& mem,
+                       std::vector<uint8_t>& cpu_state, uint32_t& sequence, std::string& error);
+
+private:
+    struct Pending {
+        uint32_t sequence;
+        bool full;
+        std::vector<uint8_t> blob;
+    };
+
+    Memory& mem;
+    std::string dir;
+    std::string config;
+    uint32_t sequence = 0;
+    uint32_t first_sequence = 0;
+    double capture_seconds = 0; // Emulation-thread time spent in capture()
+
+    std::thread writer;
+    mutable std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::condition_variable done_cv;
+    std::deque<Pending> queue;
+    bool writing = false;
+    bool need_full = false;
+    bool stopping = false;
+    uint64_t bytes_written = 0;
+
+    void writer_loop();
+    bool write_file(const Pending& pending);
+    void remove_older(uint32_t sequence);
+};
+
+#endif // CHECKPOINT_HPP
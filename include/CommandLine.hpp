@@ -0,0 +1,23 @@
+#ifndef COMMAND_LINE_HPP
+#define COMMAND_LINE_HPP
+
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+// Parses a whole unsigned decimal option value. Returns false, leaving value
+// unchanged, for empty text, signs, trailing characters, or values that do not
+// fit in T, so a typo gets the usage message instead of an exception.
+template <typename T>
+bool parse_number(const std::string& text, T& value) {
+    if (text.empty() || text[0] < '0' || text[0] > '9') return false;
+    char* end;
+    errno = 0;
+    unsigned long long parsed = std::strtoull(text.c_str(), &end, 10);
+    if (*end != '\0' || errno == ERANGE || parsed > std::numeric_limits<T>::max()) return false;
+    value = static_cast<T>(parsed);
+    return true;
+}
+
+#endif // COMMAND_LINE_HPP
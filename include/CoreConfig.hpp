@@ -0,0 +1,114 @@
+#ifndef CORE_CONFIG_HPP
+#define CORE_CONFIG_HPP
+
+#include <cstdint>
+
+// Compile-time core configurations. BasicCPU is specialized on one of these,
+// so geometry becomes constants and disabled features compile away.
+struct DefaultConfig {
+    static constexpr const char* name = "default";
+
+    // L1 data cache geometry (powers of two)
+    static constexpr uint32_t dcache_sets = 64;
+    static constexpr uint32_t dcache_ways = 1;
+    static constexpr uint32_t dcache_block_size = 64;
+
+    // Sv32 address translation: entries per TLB (instruction and data each,
+    // a power of two) and pipeline freeze cycles per page table level walked
+    static constexpr uint32_t tlb_entries = 64;
+    static constexpr uint32_t walk_level_cycles = 2;
+
+    // Print every retired instruction
+    static constexpr bool trace = false;
+
+    // Report every retirement to the observer set with set_retire_observer()
+    static constexpr bool retire_observer = false;
+
+    // Count taken/not-taken branch outcomes in the map set with set_coverage_map()
+    static constexpr bool coverage = false;
+
+    // Count pipeline activity for the energy model (see include/Energy.hpp)
+    static constexpr bool energy = false;
+
+    // Record every data-cache access to the writer set with set_mem_trace()
+    static constexpr bool mem_trace = false;
+
+    // RVV subset (see include/VectorUnit.hpp): VLEN in bits, and how many
+    // 32-bit elements the vector datapath handles per cycle
+    static constexpr bool vector = false;
+    static constexpr uint32_t vlen = 128;
+    static constexpr uint32_t vector_lanes = 4;
+
+    // Load/store unit (see include/StoreBuffer.hpp): store buffer entries (0
+    // writes stores to memory in MEM), pipeline freeze cycles per D-cache
+    // miss, and whether misaligned loads/stores trap or are split into bytes
+    // (freezing the pipeline for split_access_cycles more)
+    static constexpr uint32_t store_buffer_entries = 0;
+    static constexpr uint32_t dcache_miss_cycles = 0;
+    static constexpr bool misaligned_trap = false;
+    static constexpr uint32_t split_access_cycles = 0;
+};
+
+struct TraceConfig : DefaultConfig {
+    static constexpr const char* name = "trace";
+    static constexpr bool trace = true;
+};
+
+struct LargeCacheConfig : DefaultConfig {
+    static constexpr const char* name = "large-cache";
+    static constexpr uint32_t dcache_sets = 128;
+    static constexpr uint32_t dcache_ways = 4;
+};
+
+// Lock-step co-simulation against a reference model (see tests/test_cosim.cpp)
+struct CosimConfig : DefaultConfig {
+    static constexpr const char* name = "cosim";
+    static constexpr bool retire_observer = true;
+};
+
+// In-process fuzzing with branch coverage (see include/FuzzHarness.hpp)
+struct FuzzConfig : DefaultConfig {
+    static constexpr const char* name = "fuzz";
+    static constexpr bool coverage = true;
+};
+
+// Energy and power estimation from pipeline activity
+struct EnergyConfig : DefaultConfig {
+    static constexpr const char* name = "energy";
+    static constexpr bool energy = true;
+};
+
+// Data-cache access recording for offline sweeps (see tools/cache_sweep.cpp)
+struct MemTraceConfig : DefaultConfig {
+    static constexpr const char* name = "mem-trace";
+    static constexpr bool mem_trace = true;
+};
+
+// Zve32x-level vector unit, 128-bit registers over a four-lane datapath
+struct VectorConfig : DefaultConfig {
+    static constexpr const char* name = "vector";
+    static constexpr bool vector = true;
+};
+
+// Eight-entry store buffer with forwarding, a 20-cycle D-cache miss latency,
+// and misaligned accesses raising address-misaligned exceptions
+struct LsuConfig : DefaultConfig {
+    static constexpr const char* name = "lsu";
+    static constexpr uint32_t store_buffer_entries = 8;
+    static constexpr uint32_t dcache_miss_cycles = 20;
+    static constexpr bool misaligned_trap = true;
+};
+
+// Configurations instantiated for the command-line front-end and tools
+#define FOR_EACH_CORE_CONFIG(X) \
+    X(DefaultConfig)            \
+    X(TraceConfig)              \
+    X(LargeCacheConfig)         \
+    X(CosimConfig)              \
+    X(FuzzConfig)               \
+    X(EnergyConfig)             \
+    X(MemTraceConfig)           \
+    X(VectorConfig)             \
+    X(LsuConfig)
+
+#endif // CORE_CONFIG_HPP
@@ -0,0 +1,62 @@
+#ifndef ENERGY_HPP
+#define ENERGY_HPP
+
+#include <cstdint>
+#include <string>
+
+// Pipeline activity, collected by cores built with Config::energy. Each
+// counter is one increment on a path the pipeline already takes.
+struct EnergyCounters {
+    static constexpr int ALU_OPS = 12; // ControlUnit::alu_op groups
+
+    uint64_t cycles = 0;
+    uint64_t instret = 0;
+    uint64_t fetches = 0;
+    uint64_t reg_reads = 0;
+    uint64_t alu_ops[ALU_OPS] = {};
+    uint64_t dcache_hits = 0;
+    uint64_t dcache_misses = 0;
+    uint64_t mem_bytes = 0;    // Bytes loaded and stored
+    uint64_t reg_writes = 0;
+    uint64_t flushes = 0;      // Redirects that squashed the front of the pipeline
+    uint64_t stall_cycles = 0; // Load-use stalls and page-walk freezes
+};
+
+// Energy per event in picojoules. The defaults are rough figures for a
+// simple in-order core; load_energy_table() overrides any of them.
+struct EnergyTable {
+    double fetch = 8.0;
+    double reg_read = 1.0;
+    double reg_write = 1.5;
+    // LUI, AUIPC, JAL, JALR, BRANCH, LOAD, STORE, OP-IMM, OP, SYSTEM, VECTOR,
+    // MISC-MEM. A vector instruction's entry covers its issue and control;
+    // its element traffic to memory is counted in mem_byte.
+    double alu[EnergyCounters::ALU_OPS] = {0.5, 1.0, 1.0, 1.0, 1.2, 1.0, 1.0, 1.0, 1.2, 2.0, 4.0, 0.5};
+    double dcache_hit = 5.0;
+    double dcache_miss = 60.0; // Includes the line refill
+    double mem_byte = 0.5;
+    double flush = 4.0;
+    double stall = 1.0;
+    double leakage = 3.0;      // Per cycle, whatever the pipeline does
+    double clock_mhz = 100.0;  // For converting cycles to time and power
+};
+
+struct EnergyReport {
+    static constexpr int STAGES = 5;
+    static constexpr const char* stage_names[STAGES] = {"IF", "ID", "EX", "MEM", "WB"};
+
+    double stage[STAGES] = {}; // Dynamic energy per stage, pJ
+    double control = 0;        // Flushes and stalls, pJ
+    double leakage = 0;        // pJ
+    double total = 0;          // pJ
+    double power_mw = 0;       // Average over the run at table.clock_mhz
+    double per_instruction = 0; // pJ
+};
+
+// Reads "name value" lines (alu.<group> for the ALU entries, # comments).
+// Returns false and describes the first bad line in error.
+bool load_energy_table(const std::string& path, EnergyTable& table, std::string& error);
+
+EnergyReport estimate_energy(const EnergyCounters& counters, const EnergyTable& table);
+
+#endif // ENERGY_HPP
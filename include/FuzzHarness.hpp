@@ -0,0 +1,52 @@
+#ifndef FUZZ_HARNESS_HPP
+#define FUZZ_HARNESS_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "CPU.hpp"
+#include "Memory.hpp"
+
+// Persistent in-process fuzzing of guest firmware. The firmware is loaded
+// once and RAM is snapshotted; each input then costs a core reset, a restore
+// of the pages the previous input dirtied, and the run itself.
+//
+// Guest ABI: execution starts at 0 with a0 = input address and a1 = input
+// length. The input ends at the halt ECALL. A write to CRASH_BASE reports a
+// guest-detected failure; so does any access that misses RAM and devices.
+class FuzzHarness {
+public:
+    static constexpr uint32_t CRASH_BASE = 0x20000000;
+    static constexpr uint32_t DEFAULT_INPUT_ADDR = 0x80000;
+    static constexpr uint32_t DEFAULT_INPUT_MAX = 4096;
+
+    enum class Outcome { Ok, Crash, Timeout };
+
+    FuzzHarness(const std::vector<uint32_t>& firmware, uint32_t input_addr = DEFAULT_INPUT_ADDR,
+                uint32_t input_max = DEFAULT_INPUT_MAX, uint64_t max_cycles = 1000000,
+                uint32_t mem_size = 1024 * 1024);
+
+    // Reads a raw little-endian firmware image; false if it cannot be read
+    static bool read_firmware(const std::string& path, std::vector<uint32_t>& words);
+
+    // Branch outcome counters are accumulated into map (size a power of two)
+    void set_coverage_map(uint8_t* map, uint32_t size) { cpu.set_coverage_map(map, size); }
+
+    // Runs one input from the snapshot; longer inputs are truncated to input_max
+    Outcome run(const uint8_t* data, size_t size);
+
+    uint64_t get_execs() const { return execs; }
+    const BasicCPU<FuzzConfig>& get_cpu() const { return cpu; }
+
+private:
+    Memory mem;
+    BasicCPU<FuzzConfig> cpu;
+    uint32_t input_addr;
+    uint32_t input_max;
+    uint64_t max_cycles;
+    uint64_t execs = 0;
+    bool crashed = false;
+};
+
+#endif // FUZZ_HARNESS_HPP
@@ -0,0 +1,71 @@
+#ifndef GDBSTUB_HPP
+#define GDBSTUB_HPP
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+
+template <typename Config> class BasicCPU;
+class Memory;
+
+// Minimal GDB remote serial protocol server. The stub only drives the core
+// while a debugger is connected, so an undebugged run pays nothing for it.
+template <typename Config>
+class GdbStub {
+public:
+    GdbStub(BasicCPU<Config>& cpu, Memory& mem);
+    ~GdbStub();
+
+    // Listen on "port", "host:port" or "unix:/path/to/socket"
+    bool listen(const std::string& address);
+
+    // Accept one debugger and serve it until it detaches or kills the target
+    void serve();
+
+    bool killed() const { return kill_requested; }
+
+private:
+    BasicCPU<Config>& cpu;
+    Memory& mem;
+
+    int listen_fd = -1;
+    int client_fd = -1;
+    std::string unix_path;
+    bool kill_requested = false;
+    bool detach_requested = false;
+
+    // Software breakpoints: address -> original instruction word
+    std::map<uint32_t, uint32_t> breakpoints;
+    // Addresses inserted with Z1, so their stops report hwbreak
+    std::set<uint32_t> hw_breakpoints;
+
+    static constexpr uint32_t EBREAK = 0x00100073;
+    static constexpr uint32_t NUM_REGS = 33; // x0-x31, pc
+    static constexpr uint64_t POLL_INTERVAL = 1 << 16; // cycles between checks for ^C
+
+    // Transport
+    bool read_packet(std::string& packet);
+    void send_packet(const std::string& payload);
+    bool interrupt_pending();
+
+    // Command handling
+    std::string handle_packet(const std::string& packet);
+    std::string resume(bool single_step);
+    std::string stop_reply(int signal) const;
+    std::string read_registers() const;
+    std::string write_registers(const std::string& hex);
+    std::string read_memory(const std::string& args) const;
+    std::string write_memory(const std::string& args);
+    std::string set_breakpoint(const std::string& args, bool insert);
+
+    bool insert_breakpoint(uint32_t address);
+    bool remove_breakpoint(uint32_t address);
+    void remove_all_breakpoints();
+    uint32_t read_word(uint32_t address) const;
+    void write_word(uint32_t address, uint32_t value);
+
+    void close_client();
+};
+
+#endif // GDBSTUB_HPP
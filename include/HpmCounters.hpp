@@ -0,0 +1,112 @@
+#ifndef HPM_COUNTERS_HPP
+#define HPM_COUNTERS_HPP
+
+#include <cstdint>
+#include <array>
+
+// RISC-V hardware performance monitor: mcycle (0), minstret (2) and
+// mhpmcounter3..31, with mhpmevent selectors, mcountinhibit, and the Sscofpmf
+// overflow flag and privilege-mode filters (in mhpmeventh, as on RV32). Each event keeps a mask of the
+// counters that select it, so an event nobody counts costs a load and a branch.
+class HpmCounters {
+public:
+    static constexpr int NUM_COUNTERS = 32;
+
+    // mhpmevent event selectors (low byte)
+    static constexpr uint32_t EVENT_NONE = 0;
+    static constexpr uint32_t EVENT_LOAD_USE_STALL = 1; // Cycles ID held a load-use stall
+    static constexpr uint32_t EVENT_FLUSH = 2;          // Pipeline redirects
+    static constexpr uint32_t EVENT_DCACHE_ACCESS = 3;
+    static constexpr uint32_t EVENT_DCACHE_MISS = 4;
+    static constexpr uint32_t EVENT_BRANCH = 5;         // Conditional branches executed
+    static constexpr uint32_t EVENT_BRANCH_MISPREDICT = 6; // Taken branches and jumps (fetch predicts not-taken)
+    static constexpr uint32_t EVENT_LOAD = 7;
+    static constexpr uint32_t EVENT_STORE = 8;
+    static constexpr uint32_t EVENT_ITLB_MISS = 9;
+    static constexpr uint32_t EVENT_DTLB_MISS = 10;
+    static constexpr uint32_t EVENT_WALK_CYCLE = 11;    // Cycles frozen by page walks
+    static constexpr uint32_t EVENT_TRAP = 12;          // Exceptions and interrupts taken
+    static constexpr uint32_t EVENT_STORE_FORWARD = 13; // Loads served from the store buffer
+    static constexpr uint32_t EVENT_STORE_BUFFER_STALL = 14; // Cycles frozen waiting on the store buffer
+    static constexpr uint32_t EVENT_MISALIGNED = 15;    // Misaligned loads/stores split into bytes
+    static constexpr uint32_t EVENT_COUNT = 16;
+
+    // Sscofpmf bits 63:60 of mhpmevent, i.e. bits 31:28 of mhpmeventh
+    static constexpr uint32_t MHPMEVENTH_OF = 1u << 31;
+    static constexpr uint32_t MHPMEVENTH_MINH = 1u << 30;
+    static constexpr uint32_t MHPMEVENTH_SINH = 1u << 29;
+    static constexpr uint32_t MHPMEVENTH_UINH = 1u << 28;
+    static constexpr uint32_t MHPMEVENTH_MASK = MHPMEVENTH_OF | MHPMEVENTH_MINH | MHPMEVENTH_SINH | MHPMEVENTH_UINH;
+
+    void tick_cycle() { if (!(inhibit & 1)) counters[0]++; }
+    void tick_instret() { if (!(inhibit & 4)) counters[2]++; }
+
+    // Counts an event at privilege priv. Returns true if a counter overflowed
+    // with OF clear, i.e. a local counter-overflow interrupt should be raised.
+    bool event(uint32_t e, uint8_t priv, uint64_t amount = 1) {
+        uint32_t mask = listeners[e];
+        return mask && count(mask, priv, amount);
+    }
+
+    uint64_t get_counter(int n) const { return counters[n]; }
+    void set_counter(int n, uint64_t value) { counters[n] = value; }
+
+    uint32_t get_event(int n) const { return events[n]; }
+    void set_event(int n, uint32_t value) {
+        events[n] = value;
+        rebuild();
+    }
+
+    // mhpmeventh: only the Sscofpmf bits are implemented
+    uint32_t get_event_high(int n) const { return event_flags[n]; }
+    void set_event_high(int n, uint32_t value) { event_flags[n] = value & MHPMEVENTH_MASK; }
+
+    uint32_t get_inhibit() const { return inhibit; }
+    void set_inhibit(uint32_t value) {
+        inhibit = value & ~2u; // No time counter to inhibit
+        rebuild();
+    }
+
+    // OF bits of counters 3..31 at their counter positions (scountovf layout)
+    uint32_t overflow_bits() const {
+        uint32_t bits = 0;
+        for (int n = 3; n < NUM_COUNTERS; ++n) {
+            if (event_flags[n] & MHPMEVENTH_OF) bits |= 1u << n;
+        }
+        return bits;
+    }
+
+private:
+    std::array<uint64_t, NUM_COUNTERS> counters{};
+    std::array<uint32_t, NUM_COUNTERS> events{};
+    std::array<uint32_t, NUM_COUNTERS> event_flags{};
+    std::array<uint32_t, EVENT_COUNT> listeners{};
+    uint32_t inhibit = 0;
+
+    bool count(uint32_t mask, uint8_t priv, uint64_t amount) {
+        // Privilege levels 0 (U), 1 (S) and 3 (M) map to the xINH filter bits
+        uint32_t filter = priv == 3 ? MHPMEVENTH_MINH : priv == 1 ? MHPMEVENTH_SINH : MHPMEVENTH_UINH;
+        bool raise = false;
+        for (; mask; mask &= mask - 1) {
+            int n = __builtin_ctz(mask);
+            if (event_flags[n] & filter) continue;
+            uint64_t before = counters[n];
+            counters[n] += amount;
+            if (counters[n] < before && !(event_flags[n] & MHPMEVENTH_OF)) {
+                event_flags[n] |= MHPMEVENTH_OF;
+                raise = true;
+            }
+        }
+        return raise;
+    }
+
+    void rebuild() {
+        listeners = {};
+        for (int n = 3; n < NUM_COUNTERS; ++n) {
+            uint32_t e = events[n];
+            if (e != EVENT_NONE && e < EVENT_COUNT && !(inhibit & (1u << n))) listeners[e] |= 1u << n;
+        }
+    }
+};
+
+#endif // HPM_COUNTERS_HPP
@@ -0,0 +1,84 @@
+#ifndef MEM_TRACE_HPP
+#define MEM_TRACE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Data-cache access stream, as sent to dcache.access(). The file is the
+// magic "RVMTRC01" followed by one LEB128 varint per access: the address
+// delta from the previous access, zigzag encoded, shifted left once with the
+// write flag in bit 0. Sequential and stack traffic take one byte per access.
+class MemTraceWriter {
+public:
+    ~MemTraceWriter() { close(); }
+
+    bool open(const std::string& path);
+    // Flushes and closes; false if any write failed
+    bool close();
+
+    void record(uint32_t address, bool is_write) {
+        uint32_t delta = address - last;
+        last = address;
+        uint64_t value = (uint64_t)((delta << 1) ^ (uint32_t)((int32_t)delta >> 31)) << 1 | is_write;
+        if (used + 5 > buffer.size()) flush();
+        do {
+            uint8_t byte = value & 0x7F;
+            value >>= 7;
+            buffer[used++] = byte | (value ? 0x80 : 0);
+        } while (value);
+        count++;
+    }
+
+    uint64_t get_count() const { return count; }
+    uint64_t get_bytes() const { return bytes + used; }
+
+private:
+    FILE* file = nullptr;
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(1 << 16);
+    size_t used = 0;
+    uint32_t last = 0;
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    bool ok = true;
+
+    void flush();
+};
+
+class MemTraceReader {
+public:
+    ~MemTraceReader() { if (file) std::fclose(file); }
+
+    // False if the file cannot be read or is not a trace
+    bool open(const std::string& path);
+
+    // False at the end of the trace (or at a truncated record)
+    bool next(uint32_t& address, bool& is_write) {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            if (pos == end && !refill()) return false;
+            uint8_t byte = buffer[pos++];
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                uint32_t zigzag = value >> 1;
+                last += (zigzag >> 1) ^ (0u - (zigzag & 1));
+                address = last;
+                is_write = value & 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    FILE* file = nullptr;
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(1 << 16);
+    size_t pos = 0;
+    size_t end = 0;
+    uint32_t last = 0;
+
+    bool refill();
+};
+
+#endif // MEM_TRACE_HPP
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <vector>
+#include <functional>
 
 class Memory {
 public:
@@ -10,9 +11,18 @@ public:
     static constexpr uint32_t UART_BASE = 0x10000000;
     static constexpr uint32_t UART_THR  = 0x00; // Transmitter Holding Register
 
+    // Host MMIO callbacks; offsets are relative to the region base
+    using MmioRead = std::function<uint32_t(uint32_t offset, uint32_t size)>;
+    using MmioWrite = std::function<void(uint32_t offset, uint32_t value, uint32_t size)>;
+
     // Initialize memory with a specific size (default 1MB)
     Memory(uint32_t size = 1024 * 1024);
 
+    uint32_t size() const { return static_cast<uint32_t>(mem.size()); }
+
+    // Map a device region outside RAM. Accesses to it never reach the data cache.
+    void map_mmio(uint32_t base, uint32_t size, MmioRead read, MmioWrite write);
+
     // Read a 32-bit word from memory
     uint32_t read32(uint32_t address) const;
 
@@ -22,6 +32,10 @@ public:
     // Read an 8-bit byte from memory
     uint8_t read8(uint32_t address) const;
 
+    // Instruction fetch and page-table reads: read32 without the watchpoint
+    // check, so only the core's loads can fire a read watchpoint
+    uint32_t fetch32(uint32_t address) const;
+
     // Write a 32-bit word to memory
     void write32(uint32_t address, uint32_t value);
 
@@ -34,8 +48,83 @@ public:
     // Load a program into memory starting at an offset
     void load_program(const std::vector<uint32_t>& program, uint32_t start_address = 0);
 
+    // Host pointer into RAM for device DMA, or nullptr unless the whole range
+    // is RAM. Bypasses watchpoints; pass write = true if the device will write
+    // through it, so the pages count as dirty.
+    uint8_t* dma(uint32_t address, uint32_t length, bool write);
+
+    // Debugger access: RAM only, bypasses MMIO side effects and watchpoints
+    bool debug_read8(uint32_t address, uint8_t& value) const;
+    bool debug_write8(uint32_t address, uint8_t value);
+
+    // Watchpoints. Pages that hold a watched range carry a protection bit, so
+    // only accesses to those pages pay for the precise range check.
+    static constexpr uint32_t PAGE_SHIFT = 12;
+    static constexpr uint8_t WATCH_READ = 1, WATCH_WRITE = 2;
+
+    bool add_watchpoint(uint32_t address, uint32_t length, uint8_t kind);
+    bool remove_watchpoint(uint32_t address, uint32_t length, uint8_t kind);
+    void clear_watchpoints();
+
+    // Returns true (once) if a watchpoint fired since the last call
+    bool take_watch_hit(uint32_t& address, uint8_t& kind);
+    bool watch_pending() const { return watch_hit; }
+
+    // Dirty-page tracking. A RAM write sets every consumer bit of its page and
+    // each consumer clears only its own, so they never disturb one another.
+    static constexpr uint8_t DIRTY_SNAPSHOT = 1;
+    static constexpr uint8_t DIRTY_CHECKPOINT = 2;
+    static constexpr uint8_t DIRTY_ALL = 0xFF;
+
+    uint32_t page_count() const { return static_cast<uint32_t>(page_dirty.size()); }
+    bool is_dirty(uint32_t page, uint8_t consumer) const { return page_dirty[page] & consumer; }
+    void clear_dirty(uint8_t consumer);
+
+    // Snapshot/restore for persistent (fuzzing) runs: restore_snapshot() copies
+    // back only the pages written since snapshot() or the last restore.
+    void snapshot();
+    void restore_snapshot();
+
+    // Accesses that hit neither RAM nor a device
+    uint64_t get_bus_errors() const { return bus_errors; }
+
 private:
+    struct Watchpoint {
+        uint32_t address;
+        uint32_t length;
+        uint8_t kind;
+    };
+
+    struct MmioRegion {
+        uint32_t base;
+        uint32_t size;
+        MmioRead read;
+        MmioWrite write;
+    };
+
     std::vector<uint8_t> mem;
+    std::vector<MmioRegion> regions;
+    std::vector<uint8_t> page_prot;
+    std::vector<Watchpoint> watchpoints;
+    std::vector<uint8_t> page_dirty;
+    std::vector<uint8_t> baseline;
+    mutable uint64_t bus_errors = 0;
+
+    mutable bool watch_hit = false;
+    mutable uint32_t watch_hit_addr = 0;
+    mutable uint8_t watch_hit_kind = 0;
+
+    bool watched(uint32_t address, uint32_t size) const {
+        return page_prot[address >> PAGE_SHIFT] | page_prot[(address + size - 1) >> PAGE_SHIFT];
+    }
+    void mark_dirty(uint32_t address, uint32_t size) {
+        page_dirty[address >> PAGE_SHIFT] = DIRTY_ALL;
+        page_dirty[(address + size - 1) >> PAGE_SHIFT] = DIRTY_ALL;
+    }
+    uint32_t device_read(uint32_t address, uint32_t size, const char* what) const;
+    void device_write(uint32_t address, uint32_t value, uint32_t size, const char* what);
+    void check_watch(uint32_t address, uint32_t size, uint8_t kind) const;
+    void rebuild_page_prot();
 };
 
 #endif // MEMORY_HPP
@@ -0,0 +1,105 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Raw counters at one point of a run
+struct MetricsSample {
+    uint64_t cycles = 0;
+    uint64_t instret = 0;
+    uint64_t cache_hits = 0;
+    uint64_t cache_misses = 0;
+    double host_seconds = 0; // Since the run started
+};
+
+// Single-writer seqlock. The emulation thread publishes without ever
+// blocking; readers retry if a publish overlapped their copy.
+class MetricsPublisher {
+public:
+    void publish(const MetricsSample& sample) {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed); // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        cycles.store(sample.cycles, std::memory_order_relaxed);
+        instret.store(sample.instret, std::memory_order_relaxed);
+        cache_hits.store(sample.cache_hits, std::memory_order_relaxed);
+        cache_misses.store(sample.cache_misses, std::memory_order_relaxed);
+        host_seconds.store(sample.host_seconds, std::memory_order_relaxed);
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    // Copies the latest sample; returns its sequence number (0: none yet)
+    uint32_t read(MetricsSample& sample) const {
+        for (;;) {
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+            sample.cycles = cycles.load(std::memory_order_relaxed);
+            sample.instret = instret.load(std::memory_order_relaxed);
+            sample.cache_hits = cache_hits.load(std::memory_order_relaxed);
+            sample.cache_misses = cache_misses.load(std::memory_order_relaxed);
+            sample.host_seconds = host_seconds.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) return before;
+        }
+    }
+
+private:
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<uint64_t> cycles{0};
+    std::atomic<uint64_t> instret{0};
+    std::atomic<uint64_t> cache_hits{0};
+    std::atomic<uint64_t> cache_misses{0};
+    std::atomic<double> host_seconds{0};
+};
+
+// Side thread that reads the publisher every period and exports the rates
+// over the last period: appended to a CSV or JSON-lines file, or served as
+// the latest JSON sample to each client of a Unix socket.
+class MetricsSampler {
+public:
+    MetricsSampler(const MetricsPublisher& publisher, std::chrono::milliseconds period);
+    ~MetricsSampler();
+
+    // "csv:path", "json:path" or "unix:path"; false if the sink cannot be opened
+    bool open(const std::string& sink);
+
+    void start();
+    // Exports the final sample and joins the thread
+    void stop();
+
+    // One sample with rates relative to prev, without a trailing newline
+    static std::string format_json(const MetricsSample& sample, const MetricsSample& prev);
+    static std::string format_csv(const MetricsSample& sample, const MetricsSample& prev);
+
+private:
+    enum class Format { Csv, Json, Unix };
+
+    const MetricsPublisher& publisher;
+    std::chrono::milliseconds period;
+    Format format = Format::Csv;
+    std::ofstream file;
+    int listen_fd = -1;
+    std::string unix_path;
+
+    std::thread thread;
+    std::mutex stop_mutex;
+    std::condition_variable stop_cv;
+    bool stopping = false;
+
+    uint32_t last_sequence = 0;
+    MetricsSample prev;
+    std::string latest; // Last JSON sample, for socket clients
+
+    void loop();
+    void sample();
+    void serve_clients(int timeout_ms);
+};
+
+#endif // METRICS_HPP
@@ -0,0 +1,81 @@
+#ifndef STORE_BUFFER_HPP
+#define STORE_BUFFER_HPP
+
+#include <cstdint>
+#include <array>
+
+struct StoreBufferEntry {
+    uint32_t addr = 0;
+    uint32_t value = 0;
+    uint32_t size = 0;   // Bytes; may be misaligned when accesses are split
+    uint32_t cycles = 0; // Cycles until the store reaches memory once at the head
+};
+
+// Load/store unit activity, counted in configurations with a store buffer or
+// a D-cache miss latency (split accesses are counted in every configuration)
+struct LsuStats {
+    uint64_t forwarded_loads = 0;  // Loads served from the store buffer
+    uint64_t full_stall_cycles = 0; // Stores waiting for a free entry
+    uint64_t drain_stall_cycles = 0; // Waiting for the buffer to empty (partial overlaps, MMIO loads, host ECALLs, vector accesses)
+    uint64_t fence_cycles = 0;     // FENCE/FENCE.I/SFENCE.VMA waiting for the buffer to empty
+    uint64_t miss_cycles = 0;      // Loads (and unbuffered stores) waiting on D-cache misses
+    uint64_t split_accesses = 0;   // Misaligned loads/stores done as byte accesses
+};
+
+// FIFO of retired stores between MEM and memory. Stores drain in order
+// through one write port, so a younger store never overtakes an older one
+// (TSO for a single hart). One slot past Entries holds a store that arrived
+// while the buffer was full; the pipeline stays frozen until the head drains.
+template <uint32_t Entries>
+class StoreBuffer {
+    static_assert(Entries > 0, "A store buffer needs at least one entry");
+
+public:
+    enum class Match { None, Forward, Partial };
+
+    bool empty() const { return count == 0; }
+    bool full() const { return count >= Entries; }
+    StoreBufferEntry& front() { return entries[head]; }
+
+    void push(uint32_t addr, uint32_t value, uint32_t size, uint32_t cycles) {
+        entries[(head + count) % Capacity] = {addr, value, size, cycles};
+        count++;
+    }
+
+    void pop() {
+        head = (head + 1) % Capacity;
+        count--;
+    }
+
+    // Looks for the youngest store overlapping [addr, addr + size). Forward
+    // fills value if that store covers every byte of the load.
+    Match lookup(uint32_t addr, uint32_t size, uint32_t& value) const {
+        for (uint32_t i = count; i-- > 0;) {
+            const StoreBufferEntry& e = entries[(head + i) % Capacity];
+            if (addr + size <= e.addr || e.addr + e.size <= addr) continue;
+            if (addr < e.addr || addr + size > e.addr + e.size) return Match::Partial;
+            uint32_t shift = (addr - e.addr) * 8;
+            value = size == 4 ? e.value >> shift : (e.value >> shift) & ((1u << (size * 8)) - 1);
+            return Match::Forward;
+        }
+        return Match::None;
+    }
+
+    // Cycles until every buffered store has drained
+    uint32_t pending_cycles() const {
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < count; ++i) total += entries[(head + i) % Capacity].cycles;
+        return total;
+    }
+
+private:
+    static constexpr uint32_t Capacity = Entries + 1;
+    std::array<StoreBufferEntry, Capacity> entries{};
+    uint32_t head = 0;
+    uint32_t count = 0;
+};
+
+// Stand-in for configurations without a store buffer
+struct NoStoreBuffer {};
+
+#endif // STORE_BUFFER_HPP
@@ -0,0 +1,69 @@
+#ifndef TLB_HPP
+#define TLB_HPP
+
+#include <cstdint>
+#include <array>
+
+// Sv32 page table entry bits
+static constexpr uint32_t PTE_V = 1 << 0, PTE_R = 1 << 1, PTE_W = 1 << 2, PTE_X = 1 << 3;
+static constexpr uint32_t PTE_U = 1 << 4, PTE_G = 1 << 5, PTE_A = 1 << 6, PTE_D = 1 << 7;
+
+struct TlbEntry {
+    bool valid = false;
+    uint16_t asid = 0;
+    uint32_t vpn = 0;
+    uint32_t ppn = 0;
+    uint8_t flags = 0; // Leaf PTE bits 0-7
+};
+
+// Direct-mapped software TLB with ASID tags. Megapages are cached per 4 KiB
+// page, so a lookup is one hashed index and one compare whatever the page size.
+template <uint32_t NumEntries>
+class Tlb {
+    static_assert(NumEntries > 0 && (NumEntries & (NumEntries - 1)) == 0, "NumEntries must be a power of two");
+
+public:
+    // Returns the matching entry, or nullptr on a miss
+    TlbEntry* lookup(uint32_t vpn, uint16_t asid) {
+        TlbEntry& e = entries[index(vpn)];
+        if (e.valid && e.vpn == vpn && (e.asid == asid || (e.flags & PTE_G))) {
+            hits++;
+            return &e;
+        }
+        misses++;
+        return nullptr;
+    }
+
+    TlbEntry& insert(uint32_t vpn, uint16_t asid, uint32_t ppn, uint8_t flags) {
+        TlbEntry& e = entries[index(vpn)];
+        e = {true, asid, vpn, ppn, flags};
+        return e;
+    }
+
+    // SFENCE.VMA semantics: any_vpn/any_asid select the rs1 == x0 / rs2 == x0 forms
+    void flush(bool any_vpn, uint32_t vpn, bool any_asid, uint16_t asid) {
+        for (TlbEntry& e : entries) {
+            if (!e.valid) continue;
+            if (!any_vpn && e.vpn != vpn) continue;
+            if (!any_asid && (e.asid != asid || (e.flags & PTE_G))) continue;
+            e.valid = false;
+        }
+    }
+
+    void flush_all() { entries = {}; }
+
+    uint64_t get_hits() const { return hits; }
+    uint64_t get_misses() const { return misses; }
+
+private:
+    static uint32_t index(uint32_t vpn) {
+        // Fold the megapage number in, so identically laid out regions do not collide
+        return (vpn ^ ((vpn >> 10) * 0x9E5u)) & (NumEntries - 1);
+    }
+
+    std::array<TlbEntry, NumEntries> entries{};
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+#endif // TLB_HPP
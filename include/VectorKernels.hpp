@@ -0,0 +1,19 @@
+#ifndef VECTOR_KERNELS_HPP
+#define VECTOR_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Host SIMD bodies for unmasked element-wise vector instructions: AVX2 or
+// SSE2 as the build allows. Each returns how many leading bytes it handled (a
+// whole number of host vectors, possibly zero); the caller finishes the rest
+// element by element, so every kernel has a scalar fallback.
+enum class VectorOp { Add, Sub, And, Or, Xor, Mul };
+
+// vd[i] = vs2[i] op vs1[i]
+size_t simd_vv(VectorOp op, uint32_t sew_bytes, uint8_t* vd, const uint8_t* vs2, const uint8_t* vs1, size_t bytes);
+
+// vd[i] = vs2[i] op scalar
+size_t simd_vx(VectorOp op, uint32_t sew_bytes, uint8_t* vd, const uint8_t* vs2, uint32_t scalar, size_t bytes);
+
+#endif // VECTOR_KERNELS_HPP
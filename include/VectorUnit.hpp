@@ -0,0 +1,316 @@
+#ifndef VECTOR_UNIT_HPP
+#define VECTOR_UNIT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <type_traits>
+#include "VectorKernels.hpp"
+
+// RVV 1.0 state and arithmetic for a Zve32x-level subset: SEW 8/16/32, LMUL
+// 1/4 to 8, vset{i}vl{i}, and the single-width integer, compare, merge,
+// multiply/divide and reduction instructions. Tail and masked-off elements
+// are left undisturbed, which either policy in vtype allows. Lanes is the
+// datapath width in 32-bit elements; narrower elements pack into a lane, so
+// an instruction keeps EX busy for about vl / (Lanes * 4 / SEW bytes) cycles.
+// Loads and stores go through the core (see BasicCPU::vector_access).
+template <uint32_t VLEN, uint32_t Lanes>
+class VectorUnit {
+    static_assert(VLEN >= 32 && VLEN <= 4096 && (VLEN & (VLEN - 1)) == 0, "VLEN must be a power of two in [32, 4096]");
+    static_assert(Lanes > 0 && (Lanes & (Lanes - 1)) == 0, "Lanes must be a power of two");
+
+public:
+    static constexpr uint32_t VLENB = VLEN / 8;
+    static constexpr uint32_t VTYPE_VILL = 1u << 31;
+
+    uint32_t get_vl() const { return vl; }
+    uint32_t get_vtype() const { return vtype; }
+    uint32_t get_vstart() const { return vstart; }
+    void set_vstart(uint32_t value) { vstart = value & (VLEN - 1); }
+
+    // Executes an OP-V instruction given x[rs1] and x[rs2]. x_out receives the
+    // result of the instructions that write x[rd] (vset*, vmv.x.s) and busy
+    // the cycles it occupies EX. Returns false for an illegal instruction or
+    // one outside the subset.
+    bool execute(uint32_t instr, uint32_t x1, uint32_t x2, uint32_t& x_out, uint32_t& busy);
+
+    // Registers in a group of elem_bytes elements under the current vtype
+    // (EMUL, at least one), or 0 if vtype is illegal or EMUL out of range
+    uint32_t emul_regs(uint32_t elem_bytes) const {
+        if (vtype & VTYPE_VILL) return 0;
+        int emul = lmul_log2() + log2(elem_bytes) - log2(sew_bytes());
+        return emul < -3 || emul > 3 ? 0 : 1u << std::max(emul, 0);
+    }
+
+    // Cycles to stream vl elements of elem_bytes through the datapath
+    uint32_t cycles(uint32_t elem_bytes) const {
+        uint32_t per_cycle = Lanes * 4 / elem_bytes;
+        return std::max<uint32_t>(1, (vl + per_cycle - 1) / per_cycle);
+    }
+
+    // Element storage and the v0 mask, for loads and stores
+    uint8_t* element(uint32_t vreg, uint32_t index, uint32_t elem_bytes) {
+        return &regs[vreg * VLENB + index * elem_bytes];
+    }
+    bool active(uint32_t index, bool masked) const { return !masked || ((regs[index / 8] >> (index % 8)) & 1); }
+
+private:
+    alignas(32) std::array<uint8_t, 32 * VLENB> regs{};
+    uint32_t vl = 0;
+    uint32_t vtype = VTYPE_VILL;
+    uint32_t vstart = 0;
+
+    static int log2(uint32_t value) { return value >= 4 ? 2 : value - 1; } // 1, 2 or 4
+    uint32_t sew_bytes() const { return 1u << ((vtype >> 3) & 0x7); }
+    int lmul_log2() const { return (vtype & 0x4) ? (int)(vtype & 0x7) - 8 : vtype & 0x7; }
+
+    uint32_t configure(uint32_t avl, uint32_t new_vtype);
+
+    template <typename T> T get(uint32_t vreg, uint32_t index) const {
+        T value;
+        std::memcpy(&value, &regs[vreg * VLENB + index * sizeof(T)], sizeof(T));
+        return value;
+    }
+    template <typename T> void set(uint32_t vreg, uint32_t index, T value) {
+        std::memcpy(&regs[vreg * VLENB + index * sizeof(T)], &value, sizeof(T));
+    }
+
+    template <typename T> bool execute_sew(uint32_t instr, uint32_t x1, uint32_t& x_out, uint32_t& busy);
+    template <typename T> static bool binary(uint32_t funct3, uint32_t funct6, T a, T b, T& d);
+    template <typename T> static T reduce(uint32_t funct6, T acc, T value);
+};
+
+// Sets vtype and returns the new vl; an unsupported vtype sets vill and vl = 0
+template <uint32_t VLEN, uint32_t Lanes>
+uint32_t VectorUnit<VLEN, Lanes>::configure(uint32_t avl, uint32_t new_vtype) {
+    uint32_t sew = (new_vtype >> 3) & 0x7;
+    uint32_t lmul = new_vtype & 0x7;
+    // ELEN is 32: no 64-bit elements, and fractional LMUL only down to SEW/32
+    bool legal = !(new_vtype >> 8) && sew <= 2 && lmul != 4 && (lmul < 4 || (int)sew <= (int)lmul - 6);
+    vstart = 0;
+    if (!legal) {
+        vtype = VTYPE_VILL;
+        return vl = 0;
+    }
+    vtype = new_vtype;
+    uint32_t vlmax = (VLEN >> (3 + sew));
+    vlmax = lmul < 4 ? vlmax << lmul : vlmax >> (8 - lmul);
+    return vl = std::min(avl, vlmax);
+}
+
+template <uint32_t VLEN, uint32_t Lanes>
+bool VectorUnit<VLEN, Lanes>::execute(uint32_t instr, uint32_t x1, uint32_t x2, uint32_t& x_out, uint32_t& busy) {
+    uint32_t funct3 = (instr >> 12) & 0x7;
+    uint32_t rs1 = (instr >> 15) & 0x1F;
+    uint32_t rd = (instr >> 7) & 0x1F;
+    busy = 1;
+    if (funct3 == 7) { // vsetvli, vsetivli, vsetvl
+        if ((instr >> 30) == 0x3) {
+            x_out = configure(rs1, (instr >> 20) & 0x3FF);
+            return true;
+        }
+        if ((instr >> 31) && ((instr >> 25) & 0x3F)) return false;
+        uint32_t new_vtype = (instr >> 31) ? x2 : (instr >> 20) & 0x7FF;
+        // rs1 = x0 asks for VLMAX, or keeps vl if rd is x0 too
+        uint32_t avl = rs1 ? x1 : rd ? UINT32_MAX : vl;
+        x_out = configure(avl, new_vtype);
+        return true;
+    }
+    if (funct3 == 3 && (instr >> 26) == 0x27) { // vmv<nr>r.v, independent of vtype
+        uint32_t nr = rs1 + 1;
+        uint32_t vs2 = (instr >> 20) & 0x1F;
+        if ((nr & (nr - 1)) || nr > 8 || rd % nr || vs2 % nr) return false;
+        std::memmove(&regs[rd * VLENB], &regs[vs2 * VLENB], nr * VLENB);
+        busy = std::max<uint32_t>(1, nr * VLENB / (Lanes * 4));
+        vstart = 0;
+        return true;
+    }
+    if (vtype & VTYPE_VILL) return false;
+    bool ok;
+    switch (sew_bytes()) {
+        case 1: ok = execute_sew<uint8_t>(instr, x1, x_out, busy); break;
+        case 2: ok = execute_sew<uint16_t>(instr, x1, x_out, busy); break;
+        default: ok = execute_sew<uint32_t>(instr, x1, x_out, busy); break;
+    }
+    if (ok) vstart = 0;
+    return ok;
+}
+
+template <uint32_t VLEN, uint32_t Lanes>
+template <typename T>
+bool VectorUnit<VLEN, Lanes>::execute_sew(uint32_t instr, uint32_t x1, uint32_t& x_out, uint32_t& busy) {
+    using S = std::make_signed_t<T>;
+    uint32_t funct6 = instr >> 26;
+    bool masked = !((instr >> 25) & 1);
+    uint32_t vs2 = (instr >> 20) & 0x1F;
+    uint32_t vs1 = (instr >> 15) & 0x1F;
+    uint32_t vd = (instr >> 7) & 0x1F;
+    uint32_t funct3 = (instr >> 12) & 0x7;
+    bool integer = funct3 == 0 || funct3 == 3 || funct3 == 4; // OPIVV, OPIVI, OPIVX
+    bool vector_operand = funct3 == 0 || funct3 == 2;         // OPIVV, OPMVV
+    if (funct3 == 1 || funct3 == 5) return false;             // No floating point
+    T scalar = funct3 == 3 ? (T)(int32_t)((int32_t)(vs1 << 27) >> 27) : (T)x1;
+    auto op1 = [&](uint32_t i) { return vector_operand ? get<T>(vs1, i) : scalar; };
+    uint32_t group = 1u << std::max(lmul_log2(), 0);
+    busy = cycles(sizeof(T));
+
+    if (!integer && funct6 < 0x08) { // Reductions: vd[0] = op(vs1[0], active vs2[*])
+        if (funct3 != 2 || vs2 % group) return false;
+        if (vl) {
+            T acc = get<T>(vs1, 0);
+            for (uint32_t i = 0; i < vl; ++i) {
+                if (active(i, masked)) acc = reduce(funct6, acc, get<T>(vs2, i));
+            }
+            set<T>(vd, 0, acc);
+        }
+        // Plus the depth of the adder tree across one cycle's elements
+        for (uint32_t width = Lanes * 4 / sizeof(T); width > 1; width /= 2) busy++;
+        return true;
+    }
+    if (!integer && funct6 == 0x10) { // vmv.x.s, vmv.s.x
+        busy = 1;
+        if (funct3 == 2 && vs1 == 0 && !masked) {
+            x_out = (uint32_t)(int32_t)(S)get<T>(vs2, 0);
+            return true;
+        }
+        if (funct3 == 6 && vs2 == 0 && !masked) {
+            if (vstart < vl) set<T>(vd, 0, (T)x1);
+            return true;
+        }
+        return false;
+    }
+    if (integer && funct6 >= 0x18 && funct6 <= 0x1F) { // Compares write one mask bit per element
+        if ((funct3 == 0 && funct6 >= 0x1E) || (funct3 == 3 && (funct6 == 0x1A || funct6 == 0x1B)) || vs2 % group || (vector_operand && vs1 % group)) return false;
+        std::array<uint8_t, VLENB> mask;
+        std::memcpy(mask.data(), &regs[vd * VLENB], VLENB);
+        for (uint32_t i = vstart; i < vl; ++i) {
+            if (!active(i, masked)) continue;
+            T a = get<T>(vs2, i), b = op1(i);
+            bool bit = false;
+            switch (funct6) {
+                case 0x18: bit = a == b; break;
+                case 0x19: bit = a != b; break;
+                case 0x1A: bit = a < b; break;
+                case 0x1B: bit = (S)a < (S)b; break;
+                case 0x1C: bit = a <= b; break;
+                case 0x1D: bit = (S)a <= (S)b; break;
+                case 0x1E: bit = a > b; break;
+                case 0x1F: bit = (S)a > (S)b; break;
+            }
+            mask[i / 8] = (mask[i / 8] & ~(1u << (i % 8))) | (bit << (i % 8));
+        }
+        std::memcpy(&regs[vd * VLENB], mask.data(), VLENB);
+        return true;
+    }
+
+    // Element-wise: vd[i] = op(vs2[i], op1)
+    if (vd % group || vs2 % group || (vector_operand && vs1 % group)) return false;
+    if (integer && funct6 == 0x17) { // vmerge (masked) or vmv.v.* (vs2 = 0)
+        if (!masked && vs2 != 0) return false;
+        for (uint32_t i = vstart; i < vl; ++i) {
+            set<T>(vd, i, active(i, masked) ? op1(i) : get<T>(vs2, i));
+        }
+        return true;
+    }
+    if (masked && vd == 0) return false; // Would overwrite its own mask
+    T probe;
+    if (!binary<T>(funct3, funct6, 0, 0, probe)) return false;
+
+    uint32_t i = vstart;
+    if (!masked && vstart == 0) {
+        // Host SIMD for the common unmasked forms; the loop below finishes the tail
+        VectorOp simd;
+        bool vectorizable = true;
+        switch (integer ? funct6 : funct6 | 0x40) {
+            case 0x00: simd = VectorOp::Add; break;
+            case 0x02: simd = VectorOp::Sub; break;
+            case 0x09: simd = VectorOp::And; break;
+            case 0x0A: simd = VectorOp::Or; break;
+            case 0x0B: simd = VectorOp::Xor; break;
+            case 0x65: simd = VectorOp::Mul; break;
+            default: vectorizable = false; break;
+        }
+        if (vectorizable) {
+            uint8_t* d = &regs[vd * VLENB];
+            const uint8_t* a = &regs[vs2 * VLENB];
+            size_t done = vector_operand ? simd_vv(simd, sizeof(T), d, a, &regs[vs1 * VLENB], vl * sizeof(T))
+                                         : simd_vx(simd, sizeof(T), d, a, scalar, vl * sizeof(T));
+            i = done / sizeof(T);
+        }
+    }
+    for (; i < vl; ++i) {
+        if (!active(i, masked)) continue;
+        T d = get<T>(vd, i);
+        binary<T>(funct3, funct6, get<T>(vs2, i), op1(i), d);
+        set<T>(vd, i, d);
+    }
+    return true;
+}
+
+// One element of an element-wise instruction: a is vs2[i], b the vs1/x/imm
+// operand and d the destination (also an input to the multiply-adds). Returns
+// false for encodings outside the subset. Multiplies go through uint32_t so
+// that 16-bit elements don't promote to int and overflow it.
+template <uint32_t VLEN, uint32_t Lanes>
+template <typename T>
+bool VectorUnit<VLEN, Lanes>::binary(uint32_t funct3, uint32_t funct6, T a, T b, T& d) {
+    using S = std::make_signed_t<T>;
+    constexpr uint32_t BITS = sizeof(T) * 8;
+    constexpr S MIN = (S)((T)1 << (BITS - 1));
+    bool vv = funct3 == 0, vi = funct3 == 3;
+    if (funct3 == 0 || funct3 == 3 || funct3 == 4) {
+        switch (funct6) {
+            case 0x00: d = a + b; return true;
+            case 0x02: d = a - b; return !vi;
+            case 0x03: d = b - a; return !vv;
+            case 0x04: d = std::min(a, b); return !vi;
+            case 0x05: d = std::min((S)a, (S)b); return !vi;
+            case 0x06: d = std::max(a, b); return !vi;
+            case 0x07: d = std::max((S)a, (S)b); return !vi;
+            case 0x09: d = a & b; return true;
+            case 0x0A: d = a | b; return true;
+            case 0x0B: d = a ^ b; return true;
+            case 0x25: d = a << (b & (BITS - 1)); return true;
+            case 0x28: d = a >> (b & (BITS - 1)); return true;
+            case 0x29: d = (S)a >> (b & (BITS - 1)); return true;
+        }
+        return false;
+    }
+    switch (funct6) {
+        case 0x20: d = b == 0 ? (T)~0 : a / b; return true;
+        case 0x21: d = b == 0 ? (T)~0 : ((S)a == MIN && (S)b == -1) ? a : (T)((S)a / (S)b); return true;
+        case 0x22: d = b == 0 ? a : a % b; return true;
+        case 0x23: d = b == 0 ? a : ((S)a == MIN && (S)b == -1) ? 0 : (T)((S)a % (S)b); return true;
+        case 0x24: d = ((uint64_t)a * b) >> BITS; return true;
+        case 0x25: d = T(uint32_t(a) * b); return true;
+        case 0x26: d = ((int64_t)(S)a * (int64_t)(uint64_t)b) >> BITS; return true;
+        case 0x27: d = ((int64_t)(S)a * (S)b) >> BITS; return true;
+        case 0x29: d = T(uint32_t(b) * d + a); return true;
+        case 0x2B: d = T(a - uint32_t(b) * d); return true;
+        case 0x2D: d = T(uint32_t(b) * a + d); return true;
+        case 0x2F: d = T(d - uint32_t(b) * a); return true;
+    }
+    return false;
+}
+
+template <uint32_t VLEN, uint32_t Lanes>
+template <typename T>
+T VectorUnit<VLEN, Lanes>::reduce(uint32_t funct6, T acc, T value) {
+    using S = std::make_signed_t<T>;
+    switch (funct6) {
+        case 0x00: return acc + value;
+        case 0x01: return acc & value;
+        case 0x02: return acc | value;
+        case 0x03: return acc ^ value;
+        case 0x04: return std::min(acc, value);
+        case 0x05: return std::min((S)acc, (S)value);
+        case 0x06: return std::max(acc, value);
+        default: return std::max((S)acc, (S)value);
+    }
+}
+
+// Member type for configurations without the vector unit
+struct NoVectorUnit {};
+
+#endif // VECTOR_UNIT_HPP
@@ -0,0 +1,130 @@
+#ifndef VIRTIO_BLOCK_HPP
+#define VIRTIO_BLOCK_HPP
+
+#include <cstdint>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/uio.h>
+
+class Memory;
+
+// virtio-mmio (version 2) block device backed by a host image file. Requests
+// are handed to a pool of I/O threads that preadv/pwritev directly between the
+// file and guest RAM, and completions raise the interrupt line while the core
+// keeps executing. One request queue; no indirect descriptors.
+//
+// Only the CPU thread touches the rings, queue registers and interrupt line.
+// An I/O thread writes the data buffers and status byte, hands the completion
+// over under completion_mutex and calls request_poll. The CPU thread then
+// runs poll(), which fills in the used ring and index and only afterwards
+// raises the interrupt. The mutex orders the I/O thread's writes before the
+// new used index, so the guest never sees a request as done before its data,
+// and a driver polling used->idx sees it without touching a register.
+class VirtioBlock {
+public:
+    static constexpr uint32_t DEFAULT_BASE = 0x10001000;
+    static constexpr uint32_t MMIO_SIZE = 0x200;
+    static constexpr uint32_t QUEUE_SIZE_MAX = 128;
+    static constexpr uint32_t SECTOR_SIZE = 512;
+
+    using IrqCallback = std::function<void(bool level)>;
+    using PollRequest = std::function<void()>; // Asks the CPU thread to call poll()
+
+    struct Stats {
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t flushes = 0;
+        uint64_t errors = 0;
+        uint64_t bytes_read = 0;
+        uint64_t bytes_written = 0;
+        uint32_t max_queue_depth = 0;
+        double avg_queue_depth = 0; // In-flight requests seen by each new submission
+        double busy_seconds = 0;    // Wall time with at least one request in flight
+    };
+
+    VirtioBlock(Memory& mem, IrqCallback irq, PollRequest request_poll, unsigned io_threads = 4);
+    ~VirtioBlock();
+
+    // Opens the backing image read-write; false if it cannot be opened
+    bool open(const std::string& path);
+
+    // Register interface, for Memory::map_mmio
+    uint32_t mmio_read(uint32_t offset, uint32_t size);
+    void mmio_write(uint32_t offset, uint32_t value, uint32_t size);
+
+    // CPU thread: publishes finished requests into the used ring, then raises
+    // the interrupt. Register accesses also poll.
+    void poll();
+
+    // Blocks until every submitted request has completed; poll() publishes them
+    void wait_idle();
+
+    uint64_t capacity_sectors() const { return capacity; }
+    Stats get_stats() const;
+
+private:
+    struct Request {
+        uint16_t head = 0;
+        uint32_t type = 0;
+        uint64_t sector = 0;
+        std::vector<iovec> data; // Host pointers into guest RAM
+        uint8_t* status = nullptr;
+    };
+
+    Memory& mem;
+    IrqCallback irq;
+    PollRequest request_poll;
+    int fd = -1;
+    uint64_t capacity = 0;
+
+    // Device registers (CPU thread only)
+    uint32_t device_status = 0;
+    uint32_t device_features_sel = 0;
+    uint32_t driver_features_sel = 0;
+    uint64_t driver_features = 0;
+    uint32_t queue_num = QUEUE_SIZE_MAX;
+    bool queue_ready = false;
+    uint32_t desc_addr = 0, avail_addr = 0, used_addr = 0;
+    uint16_t last_avail = 0;
+    uint16_t used_idx = 0;
+    uint32_t interrupt_status = 0;
+
+    // Finished requests, waiting for the CPU thread to put them in the used ring
+    struct Completion {
+        uint16_t head;
+        uint32_t written;
+    };
+    std::mutex completion_mutex;
+    std::vector<Completion> completed;
+
+    // Thread pool
+    std::vector<std::thread> workers;
+    std::deque<Request> queue;
+    mutable std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::condition_variable idle_cv;
+    uint32_t in_flight = 0;
+    bool stopping = false;
+
+    // Statistics, guarded by queue_mutex
+    Stats stats;
+    uint64_t depth_sum = 0;
+    uint64_t submissions = 0;
+    std::chrono::steady_clock::time_point busy_since;
+
+    void process_queue();
+    bool parse_request(uint16_t head, Request& req);
+    void submit(Request req);
+    void worker_loop();
+    void execute(Request& req);
+    void complete(const Request& req, uint32_t written);
+    void reset_device();
+};
+
+#endif // VIRTIO_BLOCK_HPP
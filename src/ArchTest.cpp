@@ -0,0 +1,191 @@
+#include "ArchTest.hpp"
+#include "CPU.hpp"
+#include "Memory.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <dirent.h>
+#include <elf.h>
+#include <sys/stat.h>
+
+namespace {
+
+constexpr const char* ELF_SUFFIX = ".elf";
+constexpr const char* REFERENCE_SUFFIX = ".reference_output";
+
+bool ends_with(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Bounds-checked copy of a header or table entry out of the file
+template <typename T>
+bool read_at(const std::vector<uint8_t>& file, uint64_t offset, T& out) {
+    if (offset > file.size() || file.size() - offset < sizeof(T)) return false;
+    std::memcpy(&out, &file[offset], sizeof(T));
+    return true;
+}
+
+bool read_symbols(const std::vector<uint8_t>& file, const Elf32_Ehdr& eh, ElfImage& image) {
+    for (uint32_t i = 0; i < eh.e_shnum; ++i) {
+        Elf32_Shdr sh, strtab;
+        if (!read_at(file, eh.e_shoff + (uint64_t)i * eh.e_shentsize, sh)) return false;
+        if (sh.sh_type != SHT_SYMTAB) continue;
+        if (!read_at(file, eh.e_shoff + (uint64_t)sh.sh_link * eh.e_shentsize, strtab)) return false;
+        if (strtab.sh_offset > file.size() || file.size() - strtab.sh_offset < strtab.sh_size) return false;
+        const char* names = reinterpret_cast<const char*>(&file[strtab.sh_offset]);
+        for (uint32_t s = 0; s < sh.sh_size / sizeof(Elf32_Sym); ++s) {
+            Elf32_Sym sym;
+            if (!read_at(file, sh.sh_offset + (uint64_t)s * sizeof(Elf32_Sym), sym)) return false;
+            if (sym.st_name == 0 || sym.st_name >= strtab.sh_size) continue;
+            image.symbols[std::string(names + sym.st_name, strnlen(names + sym.st_name, strtab.sh_size - sym.st_name))] =
+                sym.st_value;
+        }
+    }
+    return true;
+}
+
+bool read_reference(const std::string& path, std::vector<uint32_t>& words) {
+    std::ifstream in(path);
+    if (!in) return false;
+    for (std::string line; std::getline(in, line);) {
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if (line.empty()) continue;
+        char* end;
+        unsigned long value = std::strtoul(line.c_str(), &end, 16);
+        if (*end != '\0') return false;
+        words.push_back(value);
+    }
+    return true;
+}
+
+} // namespace
+
+bool load_elf(const std::string& path, Memory& mem, ElfImage& image, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    Elf32_Ehdr eh;
+    if (!read_at(file, 0, eh) || std::memcmp(eh.e_ident, ELFMAG, SELFMAG) != 0 || eh.e_ident[EI_CLASS] != ELFCLASS32 ||
+        eh.e_ident[EI_DATA] != ELFDATA2LSB || eh.e_type != ET_EXEC || eh.e_machine != EM_RISCV) {
+        error = path + " is not a 32-bit little-endian RISC-V executable";
+        return false;
+    }
+    for (uint32_t i = 0; i < eh.e_phnum; ++i) {
+        Elf32_Phdr ph;
+        if (!read_at(file, eh.e_phoff + (uint64_t)i * eh.e_phentsize, ph) || ph.p_filesz > ph.p_memsz ||
+            ph.p_offset > file.size() || file.size() - ph.p_offset < ph.p_filesz) {
+            error = path + ": truncated program header table";
+            return false;
+        }
+        if (ph.p_type != PT_LOAD) continue;
+        // RAM starts zeroed, so only the file part needs copying
+        for (uint32_t b = 0; b < ph.p_memsz; ++b) {
+            uint8_t value = b < ph.p_filesz ? file[ph.p_offset + b] : 0;
+            if (!mem.debug_write8(ph.p_paddr + b, value)) {
+                char where[64];
+                std::snprintf(where, sizeof(where), ": segment at 0x%08x is outside RAM", ph.p_paddr);
+                error = path + where;
+                return false;
+            }
+        }
+    }
+    image.entry = eh.e_entry;
+    if (!read_symbols(file, eh, image)) {
+        error = path + ": truncated symbol table";
+        return false;
+    }
+    return true;
+}
+
+std::vector<ArchTest> find_arch_tests(const std::string& path) {
+    std::vector<ArchTest> tests;
+    auto add = [&](const std::string& dir, const std::string& file) {
+        std::string stem = file.substr(0, file.size() - std::strlen(ELF_SUFFIX));
+        struct stat st;
+        std::string reference = dir + stem + REFERENCE_SUFFIX;
+        if (stat(reference.c_str(), &st) == 0) tests.push_back({stem, dir + file, reference});
+    };
+    if (ends_with(path, ELF_SUFFIX)) {
+        size_t slash = path.rfind('/');
+        add(slash == std::string::npos ? "" : path.substr(0, slash + 1), path.substr(slash + 1));
+        return tests;
+    }
+    DIR* d = opendir(path.c_str());
+    if (!d) return tests;
+    while (dirent* entry = readdir(d)) {
+        if (ends_with(entry->d_name, ELF_SUFFIX)) add(path + "/", entry->d_name);
+    }
+    closedir(d);
+    std::sort(tests.begin(), tests.end(), [](const ArchTest& a, const ArchTest& b) { return a.name < b.name; });
+    return tests;
+}
+
+ArchTestResult run_arch_test(const ArchTest& test, uint64_t max_cycles) {
+    ArchTestResult result;
+    result.name = test.name;
+    Memory mem;
+    ElfImage image;
+    std::vector<uint32_t> reference;
+    if (!load_elf(test.elf_path, mem, image, result.detail)) return result;
+    auto begin = image.symbols.find("begin_signature");
+    auto end = image.symbols.find("end_signature");
+    if (begin == image.symbols.end() || end == image.symbols.end() || end->second < begin->second) {
+        result.detail = "no begin_signature/end_signature symbols";
+        return result;
+    }
+    if (!read_reference(test.reference_path, reference)) {
+        result.detail = "cannot read " + test.reference_path;
+        return result;
+    }
+
+    CPU cpu(mem);
+    cpu.set_pc(image.entry);
+    StopReason stop = cpu.run(max_cycles);
+    result.cycles = cpu.get_cycles();
+    result.instret = cpu.get_instret();
+    if (stop != StopReason::Halted) {
+        result.detail = "did not halt within " + std::to_string(max_cycles) + " cycles";
+        return result;
+    }
+
+    uint32_t words = (end->second - begin->second) / 4;
+    if (words != reference.size()) {
+        result.detail = "signature has " + std::to_string(words) + " words, reference " + std::to_string(reference.size());
+        return result;
+    }
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < words; ++i) {
+        uint32_t addr = begin->second + i * 4;
+        uint32_t value = mem.read32(addr);
+        if (value != reference[i] && mismatches++ == 0) {
+            char first[96];
+            std::snprintf(first, sizeof(first), "word %u (0x%08x) is 0x%08x, expected 0x%08x", i, addr, value, reference[i]);
+            result.detail = first;
+        }
+    }
+    if (mismatches > 1) result.detail += " (" + std::to_string(mismatches) + " words differ)";
+    result.passed = mismatches == 0;
+    return result;
+}
+
+std::vector<ArchTestResult> run_arch_tests(const std::vector<ArchTest>& tests, unsigned threads, uint64_t max_cycles) {
+    std::vector<ArchTestResult> results(tests.size());
+    threads = std::max(1u, std::min<unsigned>(threads, tests.size()));
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (size_t i; (i = next.fetch_add(1)) < tests.size();) results[i] = run_arch_test(tests[i], max_cycles);
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    return results;
+}
@@ -1,25 +1,49 @@
 #include "CPU.hpp"
 #include "Memory.hpp"
+#include "Checkpoint.hpp"
+#include "MemTrace.hpp"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 
-CPU::CPU(Memory& memory) : mem(memory), dcache(64, 64) {
+template <typename Config>
+BasicCPU<Config>::BasicCPU(Memory& memory) : mem(memory) {
     reset();
 }
 
-void CPU::reset() {
+template <typename Config>
+void BasicCPU<Config>::reset() {
     regs.fill(0);
     pc = 0;
     csrs.clear();
     stall = false;
     halted = false;
+    draining = false;
+    pending_stop = StopReason::None;
+    cycles = 0;
+    instret = 0;
     if_id_reg = {};
     id_ex_reg = {};
     ex_mem_reg = {};
     mem_wb_reg = {};
+    dcache = {};
+    itlb = {};
+    dtlb = {};
+    priv = PRIV_M;
+    walk_cycles = 0;
+    freeze = 0;
+    energy = {};
+    mip = 0;
+    hpm = {};
+    vector_unit = {};
+    store_buffer = {};
+    lsu_stats = {};
+    update_translation();
 }
 
-void CPU::clock() {
+template <typename Config>
+void BasicCPU<Config>::clock() {
     IF_ID_Reg next_if_id = if_id_reg;
     ID_EX_Reg next_id_ex = id_ex_reg;
     EX_MEM_Reg next_ex_mem = ex_mem_reg;
@@ -28,17 +52,36 @@ void CPU::clock() {
     uint32_t sequential_pc = pc;
     bool next_flush = false;
 
-    csrs[CSR_MCYCLE]++;
+    hpm.tick_cycle();
+    cycles++;
+    if constexpr (Config::store_buffer_entries > 0) {
+        drain_store_buffer_cycle(); // The write port keeps going while the pipeline is frozen
+    }
+    if (freeze) {
+        freeze--;
+        if constexpr (Config::energy) {
+            energy.stall_cycles++;
+        }
+        return;
+    }
 
     wb_stage();
     mem_stage(next_mem_wb);
     ex_stage(next_ex_mem, target_pc, next_flush);
     id_stage(next_id_ex, next_if_id);
     if (!stall) {
-        if_stage(next_if_id, sequential_pc);
+        if (draining) {
+            next_if_id = {};
+        } else {
+            if_stage(next_if_id, sequential_pc);
+        }
     }
 
     if (next_flush) {
+        if constexpr (Config::energy) {
+            energy.flushes++;
+        }
+        hpm_event(HpmCounters::EVENT_FLUSH);
         pc = target_pc;
         if_id_reg = {};
         id_ex_reg = {};
@@ -52,27 +95,51 @@ void CPU::clock() {
     regs[0] = 0;
 }
 
-void CPU::wb_stage() {
+template <typename Config>
+void BasicCPU<Config>::wb_stage() {
     if (mem_wb_reg.valid) {
-        csrs[CSR_MINSTRET]++;
+        hpm.tick_instret();
+        instret++;
         if (mem_wb_reg.controls.reg_write && mem_wb_reg.rd != 0) {
             uint32_t result = mem_wb_reg.controls.mem_read ? mem_wb_reg.mem_data : mem_wb_reg.alu_result;
             regs[mem_wb_reg.rd] = result;
+            if constexpr (Config::energy) {
+                energy.reg_writes++;
+            }
+        }
+        if constexpr (Config::trace) {
+            trace_retire();
         }
-        if (mem_wb_reg.controls.halt) {
+        if constexpr (Config::retire_observer) {
+            notify_retire();
+        }
+        if (mem_wb_reg.controls.ecall) {
+            flush_store_buffer(lsu_stats.drain_stall_cycles); // The handler may read guest memory
+            ecall_handler(*this);
+        } else if (mem_wb_reg.controls.halt) {
+            flush_store_buffer(lsu_stats.drain_stall_cycles);
             halted = true;
+            pending_stop = StopReason::Halted;
         }
     }
 }
 
-void CPU::if_stage(IF_ID_Reg& next_if_id, uint32_t& next_pc) {
-    next_if_id.instruction = mem.read32(pc);
+template <typename Config>
+void BasicCPU<Config>::if_stage(IF_ID_Reg& next_if_id, uint32_t& next_pc) {
+    uint32_t fetch_addr = pc;
+    bool fault = translate_fetch && !translate(pc, Access::Fetch, fetch_addr);
+    next_if_id.instruction = fault ? 0 : mem.fetch32(fetch_addr);
     next_if_id.pc = pc;
+    next_if_id.fetch_fault = fault;
     next_if_id.valid = true;
     next_pc = pc + 4;
+    if constexpr (Config::energy) {
+        energy.fetches++;
+    }
 }
 
-void CPU::id_stage(ID_EX_Reg& next_id_ex, IF_ID_Reg& next_if_id) {
+template <typename Config>
+void BasicCPU<Config>::id_stage(ID_EX_Reg& next_id_ex, IF_ID_Reg& next_if_id) {
     (void)next_if_id; // Suppress unused parameter warning
     uint32_t instr = if_id_reg.instruction;
     uint8_t rs1 = (instr >> 15) & 0x1F;
@@ -83,10 +150,16 @@ void CPU::id_stage(ID_EX_Reg& next_id_ex, IF_ID_Reg& next_if_id) {
     if (if_id_reg.valid && id_ex_reg.valid && id_ex_reg.controls.mem_read && (id_ex_reg.rd == rs1 || id_ex_reg.rd == rs2) && id_ex_reg.rd != 0) {
         stall = true;
         next_id_ex = {}; 
+        if constexpr (Config::energy) {
+            energy.stall_cycles++;
+        }
+        hpm_event(HpmCounters::EVENT_LOAD_USE_STALL);
     } else {
         stall = false;
         next_id_ex.valid = if_id_reg.valid;
+        next_id_ex.fetch_fault = if_id_reg.fetch_fault;
         next_id_ex.pc = if_id_reg.pc;
+        next_id_ex.instruction = instr;
         next_id_ex.rs1 = rs1;
         next_id_ex.rs2 = rs2;
         next_id_ex.rd = rd;
@@ -116,12 +189,29 @@ void CPU::id_stage(ID_EX_Reg& next_id_ex, IF_ID_Reg& next_if_id) {
                         next_id_ex.controls.halt = true;
                     }
                     break;
+                case 0x0F: next_id_ex.controls.alu_op = 11; break; // FENCE, FENCE.I
+                case 0x07: case 0x27: case 0x57: // Vector loads, stores and OP-V
+                    if constexpr (Config::vector) {
+                        // vset{i}vl{i} and vmv.x.s write x[rd]
+                        uint8_t funct3 = next_id_ex.controls.funct3;
+                        next_id_ex.controls.reg_write = opcode == 0x57 && (funct3 == 7 || (funct3 == 2 && (instr >> 26) == 0x10));
+                        next_id_ex.controls.alu_op = 10;
+                    }
+                    break;
+            }
+            if constexpr (Config::energy) {
+                // Register file ports actually used by the format
+                uint8_t funct3 = next_id_ex.controls.funct3;
+                bool reads_rs1 = opcode != 0x37 && opcode != 0x17 && opcode != 0x6F && !(opcode == 0x73 && (funct3 == 0 || funct3 >= 5));
+                bool reads_rs2 = opcode == 0x63 || opcode == 0x23 || opcode == 0x33;
+                energy.reg_reads += reads_rs1 + reads_rs2;
             }
         }
     }
 }
 
-void CPU::ex_stage(EX_MEM_Reg& next_ex_mem, uint32_t& next_pc, bool& flush) {
+template <typename Config>
+void BasicCPU<Config>::ex_stage(EX_MEM_Reg& next_ex_mem, uint32_t& next_pc, bool& flush) {
     uint32_t op1 = id_ex_reg.reg_val1;
     uint32_t op2 = id_ex_reg.reg_val2;
     // Forwarding
@@ -137,10 +227,34 @@ void CPU::ex_stage(EX_MEM_Reg& next_ex_mem, uint32_t& next_pc, bool& flush) {
 
     uint32_t alu_op2 = id_ex_reg.controls.alu_src ? id_ex_reg.imm : op2;
     uint32_t alu_res = 0;
-    if (id_ex_reg.valid) {
+    bool retire = id_ex_reg.valid;
+    bool ecall_host = false;
+    bool trapped = false; // ECALL that trapped instead of ending the program
+    bool illegal = false;
+    uint32_t irq_cause = 0;
+    uint32_t lines = 0;
+    if (id_ex_reg.valid && !draining) {
+        lines = irq_lines.load(std::memory_order_acquire);
+        if (lines & IRQ_DEVICE_POLL) lines = poll_devices();
+    }
+    if (id_ex_reg.valid && !draining && (mip | lines) && interrupt_pending(irq_cause)) {
+        // The instruction in EX has not executed yet; it resumes at mepc/sepc
+        trap(CAUSE_INTERRUPT | irq_cause, id_ex_reg.pc);
+        retire = false;
+        flush = true;
+        next_pc = pc;
+    } else if (id_ex_reg.valid && id_ex_reg.fetch_fault) {
+        trap(CAUSE_FETCH_PAGE_FAULT, id_ex_reg.pc, id_ex_reg.pc);
+        retire = false;
+        flush = true;
+        next_pc = pc;
+    } else if (id_ex_reg.valid) {
         uint8_t alu_op = id_ex_reg.controls.alu_op;
         uint8_t funct3 = id_ex_reg.controls.funct3;
         uint8_t funct7 = id_ex_reg.controls.funct7;
+        if constexpr (Config::energy) {
+            energy.alu_ops[alu_op]++;
+        }
         switch (alu_op) {
             case 0: alu_res = id_ex_reg.imm; break; // LUI
             case 1: alu_res = id_ex_reg.pc + id_ex_reg.imm; break; // AUIPC
@@ -157,37 +271,148 @@ void CPU::ex_stage(EX_MEM_Reg& next_ex_mem, uint32_t& next_pc, bool& flush) {
                     case 0x7: alu_res = op1 & alu_op2; break;
                 }
                 break;
-            case 5: case 6: alu_res = op1 + alu_op2; break; // LOAD, STORE
-            case 9: // SYSTEM
+            case 5: case 6: { // LOAD, STORE
+                alu_res = op1 + alu_op2;
+                // The reserved widths never reach MEM
+                bool reserved = alu_op == 5 ? (funct3 == 3 || funct3 > 5) : funct3 > 2;
+                uint32_t size = access_bytes(funct3);
+                // A split access must stay within one page, so that one translation covers it
+                bool misaligned = alu_res & (size - 1);
+                if (reserved) {
+                    trap(CAUSE_ILLEGAL_INSTRUCTION, id_ex_reg.pc, id_ex_reg.instruction);
+                    retire = false;
+                    flush = true;
+                    next_pc = pc;
+                } else if (misaligned && (Config::misaligned_trap || (translate_data && ((alu_res ^ (alu_res + size - 1)) >> 12)))) {
+                    trap(alu_op == 5 ? CAUSE_LOAD_MISALIGNED : CAUSE_STORE_MISALIGNED, id_ex_reg.pc, alu_res);
+                    retire = false;
+                    flush = true;
+                    next_pc = pc;
+                } else if (translate_data && !translate(alu_res, alu_op == 5 ? Access::Load : Access::Store, alu_res)) {
+                    trap(alu_op == 5 ? CAUSE_LOAD_PAGE_FAULT : CAUSE_STORE_PAGE_FAULT, id_ex_reg.pc, op1 + alu_op2);
+                    retire = false;
+                    flush = true;
+                    next_pc = pc;
+                }
+                break;
+            }
+            case 9: { // SYSTEM
                 uint32_t csr_addr = id_ex_reg.imm;
                 uint8_t f3 = id_ex_reg.controls.funct3;
-                if (f3 == 0) { // ECALL or MRET
+                if (f3 == 0) {
                     if (csr_addr == 0x0) { // ECALL
+                        flush = true;
+                        if (ecall_handler) {
+                            // Refetch younger instructions so they observe the handler's register updates
+                            ecall_host = true;
+                            next_pc = id_ex_reg.pc + 4;
+                        } else if (priv != PRIV_M || get_csr(CSR_MTVEC) != 0) {
+                            trap(CAUSE_ECALL_U_MODE + priv, id_ex_reg.pc);
+                            trapped = true;
+                            next_pc = pc;
+                        } else {
+                            next_pc = id_ex_reg.pc;
+                        }
+                    } else if (csr_addr == 0x1) { // EBREAK
+                        if (debug_attached) {
+                            // Park on the EBREAK (it does not retire) and let older instructions drain
+                            flush = true;
+                            pending_stop = StopReason::Breakpoint;
+                            draining = true;
+                            retire = false;
+                            next_pc = id_ex_reg.pc;
+                        } else if (get_csr(CSR_MTVEC) != 0) {
+                            flush = true;
+                            trap(CAUSE_BREAKPOINT, id_ex_reg.pc, id_ex_reg.pc);
+                            next_pc = pc;
+                        }
+                    } else if (csr_addr == 0x302 || csr_addr == 0x102) { // MRET, SRET
+                        uint8_t from = csr_addr == 0x302 ? PRIV_M : PRIV_S;
+                        flush = true;
+                        if (priv < from) {
+                            illegal = true;
+                        } else {
+                            trap_return(from);
+                            next_pc = pc;
+                        }
+                    } else if ((csr_addr >> 5) == 0x09) { // SFENCE.VMA
+                        if (priv < PRIV_S) {
+                            illegal = true;
+                        } else {
+                            // Page table stores still in the store buffer must be visible to the next walk
+                            flush_store_buffer(lsu_stats.fence_cycles);
+                            itlb.flush(id_ex_reg.rs1 == 0, op1 >> 12, id_ex_reg.rs2 == 0, op2 & 0x1FF);
+                            dtlb.flush(id_ex_reg.rs1 == 0, op1 >> 12, id_ex_reg.rs2 == 0, op2 & 0x1FF);
+                        }
+                        // Refetch, since younger instructions may have been fetched through stale entries
+                        flush = true;
+                        next_pc = id_ex_reg.pc + 4;
+                    }
+                } else if (((csr_addr >> 8) & 0x3) > priv) { // CSR above the current privilege
+                    illegal = true;
+                } else if ((csr_addr >> 10) == 0x3 && ((f3 & 0x3) == 1 || id_ex_reg.rs1 != 0)) { // Read-only CSR written
+                    illegal = true;
+                } else if (!counter_enabled(csr_addr)) {
+                    illegal = true;
+                } else { // CSR
+                    uint32_t t = csr_read(csr_addr);
+                    uint32_t src = f3 >= 5 ? id_ex_reg.rs1 : op1; // Immediate forms use the rs1 field
+                    if (id_ex_reg.rd != 0) alu_res = t;
+                    switch (f3 & 0x3) {
+                        case 1: csr_write(csr_addr, src); break;
+                        case 2: if (src) csr_write(csr_addr, t | src); break;
+                        case 3: if (src) csr_write(csr_addr, t & ~src); break;
+                    }
+                    if (csr_addr == CSR_SATP && priv != PRIV_M) {
+                        // Younger instructions were fetched through the old address space
+                        flush = true;
+                        next_pc = id_ex_reg.pc + 4;
+                    }
+                }
+                if (illegal) {
+                    trap(CAUSE_ILLEGAL_INSTRUCTION, id_ex_reg.pc, id_ex_reg.instruction);
+                    retire = false;
                     flush = true;
-                    if (csrs.count(CSR_MTVEC) && csrs[CSR_MTVEC] != 0) {
-                        trap(CAUSE_ECALL_M_MODE, id_ex_reg.pc);
-                        next_pc = pc;
+                    next_pc = pc;
+                }
+                break;
+            }
+            case 10: // VECTOR
+                if constexpr (Config::vector) {
+                    uint32_t busy = 1;
+                    uint32_t cause = 0;
+                    uint32_t tval = id_ex_reg.instruction;
+                    if ((id_ex_reg.instruction & 0x7F) == 0x57) {
+                        if (!vector_unit.execute(id_ex_reg.instruction, op1, op2, alu_res, busy)) cause = CAUSE_ILLEGAL_INSTRUCTION;
                     } else {
-                        next_pc = id_ex_reg.pc;
+                        cause = vector_access(id_ex_reg.instruction, op1, op2, busy, tval);
                     }
-                } else if (csr_addr == 0x302) { // MRET
-                        next_pc = csrs.count(CSR_MEPC) ? csrs[CSR_MEPC] : 0;
+                    if (cause) {
+                        trap(cause, id_ex_reg.pc, tval);
+                        retire = false;
                         flush = true;
+                        next_pc = pc;
+                    } else {
+                        // The whole pipeline waits while the vector datapath works through vl
+                        freeze += busy - 1;
                     }
-                } else { // CSR
-                    uint32_t t = csrs.count(csr_addr) ? csrs[csr_addr] : 0;
-                    if (id_ex_reg.rd != 0) alu_res = t;
-                    if (f3 == 1) csrs[csr_addr] = op1;
-                    else if (f3 == 2) csrs[csr_addr] = t | op1;
-                    else if (f3 == 3) csrs[csr_addr] = t & ~op1;
-                    else if (f3 == 5) csrs[csr_addr] = id_ex_reg.rs1;
-                    else if (f3 == 6) csrs[csr_addr] = t | id_ex_reg.rs1;
-                    else if (f3 == 7) csrs[csr_addr] = t & ~id_ex_reg.rs1;
+                }
+                break;
+            case 11: // MISC-MEM
+                if (funct3 == 0 || funct3 == 1) { // FENCE, FENCE.I
+                    // Loads and stores complete in order in MEM, so only buffered stores need ordering
+                    flush_store_buffer(lsu_stats.fence_cycles);
+                }
+                if (funct3 == 1) {
+                    // Younger instructions were fetched before the stores FENCE.I orders them after
+                    flush = true;
+                    next_pc = id_ex_reg.pc + 4;
                 }
                 break;
         }
         // Jumps/Branches
         if (id_ex_reg.controls.jump) {
+            hpm_event(HpmCounters::EVENT_BRANCH_MISPREDICT);
             flush = true;
             next_pc = (alu_op == 2) ? id_ex_reg.pc + id_ex_reg.imm : (op1 + id_ex_reg.imm) & ~1;
         } else if (id_ex_reg.controls.branch) {
@@ -200,66 +425,581 @@ void CPU::ex_stage(EX_MEM_Reg& next_ex_mem, uint32_t& next_pc, bool& flush) {
                 case 0x6: take = (op1 < op2); break;
                 case 0x7: take = (op1 >= op2); break;
             }
-            if (take) { flush = true; next_pc = id_ex_reg.pc + id_ex_reg.imm; }
+            hpm_event(HpmCounters::EVENT_BRANCH);
+            if (take) {
+                hpm_event(HpmCounters::EVENT_BRANCH_MISPREDICT);
+                flush = true;
+                next_pc = id_ex_reg.pc + id_ex_reg.imm;
+            }
+            if constexpr (Config::coverage) {
+                record_branch(id_ex_reg.pc, take);
+            }
         }
     }
-    next_ex_mem.valid = id_ex_reg.valid;
+    next_ex_mem.valid = retire;
+    next_ex_mem.pc = id_ex_reg.pc;
+    next_ex_mem.instruction = id_ex_reg.instruction;
     next_ex_mem.alu_result = alu_res;
     next_ex_mem.reg_val2 = op2;
     next_ex_mem.rd = id_ex_reg.rd;
     next_ex_mem.controls = id_ex_reg.controls;
+    if (ecall_host) {
+        next_ex_mem.controls.ecall = true;
+    }
+    if (trapped) {
+        next_ex_mem.controls.halt = false;
+    }
 }
 
-void CPU::mem_stage(MEM_WB_Reg& next_mem_wb) {
+template <typename Config>
+void BasicCPU<Config>::mem_stage(MEM_WB_Reg& next_mem_wb) {
     next_mem_wb.valid = ex_mem_reg.valid;
+    next_mem_wb.pc = ex_mem_reg.pc;
+    next_mem_wb.instruction = ex_mem_reg.instruction;
     next_mem_wb.controls = ex_mem_reg.controls;
     next_mem_wb.rd = ex_mem_reg.rd;
     next_mem_wb.alu_result = ex_mem_reg.alu_result;
+    next_mem_wb.store_data = ex_mem_reg.reg_val2;
     uint32_t addr = ex_mem_reg.alu_result;
     uint8_t funct3 = ex_mem_reg.controls.funct3;
 
-    // Cache Access (only for non-UART addresses)
-    if (ex_mem_reg.valid && (ex_mem_reg.controls.mem_read || ex_mem_reg.controls.mem_write)) {
-        if (addr < Memory::UART_BASE) {
-            dcache.access(addr, ex_mem_reg.controls.mem_write);
+    if (!ex_mem_reg.valid || !(ex_mem_reg.controls.mem_read || ex_mem_reg.controls.mem_write)) {
+        return;
+    }
+
+    uint32_t size = access_bytes(funct3);
+    bool write = ex_mem_reg.controls.mem_write;
+    bool hit = true;
+
+    // Cache Access (only for RAM, not MMIO)
+    if (addr < mem.size()) {
+        if constexpr (Config::mem_trace) {
+            if (mem_trace) mem_trace->record(addr, write);
         }
+        hpm_event(HpmCounters::EVENT_DCACHE_ACCESS);
+        hit = dcache.access(addr, write);
+        if (!hit) hpm_event(HpmCounters::EVENT_DCACHE_MISS);
+    }
+    hpm_event(ex_mem_reg.controls.mem_read ? HpmCounters::EVENT_LOAD : HpmCounters::EVENT_STORE);
+    if constexpr (Config::energy) {
+        energy.mem_bytes += size;
+    }
+    if (addr & (size - 1)) {
+        // Split into bytes
+        lsu_stats.split_accesses++;
+        hpm_event(HpmCounters::EVENT_MISALIGNED);
+        freeze += Config::split_access_cycles;
     }
 
-    if (ex_mem_reg.valid && ex_mem_reg.controls.mem_read) {
+    if (ex_mem_reg.controls.mem_read) {
+        uint32_t value = 0;
+        bool forwarded = false;
+        if constexpr (Config::store_buffer_entries > 0) {
+            if (!store_buffer.empty()) {
+                // Device reads have side effects, so they wait for every older store
+                auto match = addr < mem.size() ? store_buffer.lookup(addr, size, value) : decltype(store_buffer)::Match::Partial;
+                if (match == decltype(store_buffer)::Match::Forward) {
+                    forwarded = true;
+                    lsu_stats.forwarded_loads++;
+                    hpm_event(HpmCounters::EVENT_STORE_FORWARD);
+                } else if (match == decltype(store_buffer)::Match::Partial) {
+                    flush_store_buffer(lsu_stats.drain_stall_cycles);
+                }
+            }
+        }
+        if (!forwarded) {
+            value = load(addr, size);
+            if (!hit && Config::dcache_miss_cycles > 0) {
+                freeze += Config::dcache_miss_cycles;
+                lsu_stats.miss_cycles += Config::dcache_miss_cycles;
+            }
+        }
         switch (funct3) {
-            case 0x0: next_mem_wb.mem_data = sign_extend(mem.read8(addr), 8); break;
-            case 0x1: next_mem_wb.mem_data = sign_extend(mem.read16(addr), 16); break;
-            case 0x2: next_mem_wb.mem_data = mem.read32(addr); break;
-            case 0x4: next_mem_wb.mem_data = mem.read8(addr); break;
-            case 0x5: next_mem_wb.mem_data = mem.read16(addr); break;
+            case 0x0: next_mem_wb.mem_data = sign_extend(value, 8); break;
+            case 0x1: next_mem_wb.mem_data = sign_extend(value, 16); break;
+            default: next_mem_wb.mem_data = value; break;
         }
     }
-    if (ex_mem_reg.valid && ex_mem_reg.controls.mem_write) {
-        switch (funct3) {
-            case 0x0: mem.write8(addr, ex_mem_reg.reg_val2 & 0xFF); break;
-            case 0x1: mem.write16(addr, ex_mem_reg.reg_val2 & 0xFFFF); break;
-            case 0x2: mem.write32(addr, ex_mem_reg.reg_val2); break;
+    if (write) {
+        uint32_t value = size == 4 ? ex_mem_reg.reg_val2 : ex_mem_reg.reg_val2 & ((1u << (size * 8)) - 1);
+        if constexpr (Config::store_buffer_entries > 0) {
+            // The store retires now; a miss only holds up the buffer's write port
+            if (store_buffer.full()) {
+                uint32_t wait = store_buffer.front().cycles;
+                freeze += wait;
+                lsu_stats.full_stall_cycles += wait;
+                hpm_event(HpmCounters::EVENT_STORE_BUFFER_STALL, wait);
+            }
+            store_buffer.push(addr, value, size, 1 + (hit ? 0 : Config::dcache_miss_cycles));
+        } else {
+            store(addr, value, size);
+            if (!hit && Config::dcache_miss_cycles > 0) {
+                freeze += Config::dcache_miss_cycles;
+                lsu_stats.miss_cycles += Config::dcache_miss_cycles;
+            }
+        }
+    }
+    if (mem.watch_pending()) {
+        pending_stop = StopReason::Watchpoint;
+        draining = true;
+    }
+}
+
+template <typename Config>
+uint32_t BasicCPU<Config>::load(uint32_t addr, uint32_t size) {
+    if (addr & (size - 1)) {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < size; ++i) value |= (uint32_t)mem.read8(addr + i) << (8 * i);
+        return value;
+    }
+    switch (size) {
+        case 1: return mem.read8(addr);
+        case 2: return mem.read16(addr);
+        default: return mem.read32(addr);
+    }
+}
+
+template <typename Config>
+void BasicCPU<Config>::store(uint32_t addr, uint32_t value, uint32_t size) {
+    if (addr & (size - 1)) {
+        for (uint32_t i = 0; i < size; ++i) mem.write8(addr + i, (value >> (8 * i)) & 0xFF);
+        return;
+    }
+    switch (size) {
+        case 1: mem.write8(addr, value); break;
+        case 2: mem.write16(addr, value); break;
+        default: mem.write32(addr, value); break;
+    }
+}
+
+// The head of the store buffer counts down its remaining cycles and is
+// written to memory when they run out
+template <typename Config>
+void BasicCPU<Config>::drain_store_buffer_cycle() {
+    if constexpr (Config::store_buffer_entries > 0) {
+        if (store_buffer.empty() || --store_buffer.front().cycles) return;
+        const StoreBufferEntry& e = store_buffer.front();
+        store(e.addr, e.value, e.size);
+        store_buffer.pop();
+        if (mem.watch_pending()) {
+            pending_stop = StopReason::Watchpoint;
+            draining = true;
         }
     }
 }
 
+template <typename Config>
+void BasicCPU<Config>::flush_store_buffer(uint64_t& stall_stat) {
+    if constexpr (Config::store_buffer_entries > 0) {
+        if (store_buffer.empty()) return;
+        uint32_t wait = store_buffer.pending_cycles();
+        while (!store_buffer.empty()) {
+            const StoreBufferEntry& e = store_buffer.front();
+            store(e.addr, e.value, e.size);
+            store_buffer.pop();
+        }
+        freeze += wait;
+        stall_stat += wait;
+        hpm_event(HpmCounters::EVENT_STORE_BUFFER_STALL, wait);
+        if (mem.watch_pending()) {
+            pending_stop = StopReason::Watchpoint;
+            draining = true;
+        }
+    } else {
+        (void)stall_stat;
+    }
+}
+
+// Unit-stride (mop 0) and strided (mop 2) accesses of 8/16/32-bit elements,
+// done in EX after older stores have completed. A page fault stops at the
+// faulting element and leaves its index in vstart, so the access resumes there.
+template <typename Config>
+uint32_t BasicCPU<Config>::vector_access(uint32_t instr, uint32_t base, uint32_t stride, uint32_t& busy, uint32_t& tval) {
+    if constexpr (Config::vector) {
+        bool store = (instr & 0x7F) == 0x27;
+        bool masked = !((instr >> 25) & 1);
+        uint32_t mop = (instr >> 26) & 0x3;
+        uint32_t width = (instr >> 12) & 0x7;
+        uint32_t vd = (instr >> 7) & 0x1F;
+        uint32_t eew = width == 0 ? 1 : width == 5 ? 2 : width == 6 ? 4 : 0;
+        uint32_t emul = eew ? vector_unit.emul_regs(eew) : 0;
+        // No segments, indexed accesses, or whole-register/mask/fault-first forms
+        if (!emul || (instr >> 28) || (mop & 1) || (mop == 0 && ((instr >> 20) & 0x1F)) || vd % emul ||
+            (masked && vd == 0 && !store)) {
+            return CAUSE_ILLEGAL_INSTRUCTION;
+        }
+        if (mop == 0) stride = eew;
+        // Vector accesses bypass the store buffer, so older scalar stores go first
+        flush_store_buffer(lsu_stats.drain_stall_cycles);
+
+        uint32_t vl = vector_unit.get_vl();
+        uint32_t last_block = UINT32_MAX;
+        for (uint32_t i = vector_unit.get_vstart(); i < vl; ++i) {
+            if (!vector_unit.active(i, masked)) continue;
+            uint32_t vaddr = base + i * stride;
+            uint32_t addr = vaddr;
+            if (translate_data && !translate(vaddr, store ? Access::Store : Access::Load, addr)) {
+                vector_unit.set_vstart(i);
+                tval = vaddr;
+                return store ? CAUSE_STORE_PAGE_FAULT : CAUSE_LOAD_PAGE_FAULT;
+            }
+            // One cache access per block touched
+            if (addr < mem.size() && addr / Config::dcache_block_size != last_block) {
+                last_block = addr / Config::dcache_block_size;
+                if constexpr (Config::mem_trace) {
+                    if (mem_trace) mem_trace->record(addr, store);
+                }
+                hpm_event(HpmCounters::EVENT_DCACHE_ACCESS);
+                if (!dcache.access(addr, store)) hpm_event(HpmCounters::EVENT_DCACHE_MISS);
+            }
+            uint8_t* element = vector_unit.element(vd, i, eew);
+            uint32_t value = 0;
+            if (store) {
+                std::memcpy(&value, element, eew);
+                switch (eew) {
+                    case 1: mem.write8(addr, value); break;
+                    case 2: mem.write16(addr, value); break;
+                    case 4: mem.write32(addr, value); break;
+                }
+            } else {
+                switch (eew) {
+                    case 1: value = mem.read8(addr); break;
+                    case 2: value = mem.read16(addr); break;
+                    case 4: value = mem.read32(addr); break;
+                }
+                std::memcpy(element, &value, eew);
+            }
+        }
+        vector_unit.set_vstart(0);
+        hpm_event(store ? HpmCounters::EVENT_STORE : HpmCounters::EVENT_LOAD);
+        if constexpr (Config::energy) {
+            energy.mem_bytes += vl * eew;
+        }
+        if (mem.watch_pending()) {
+            pending_stop = StopReason::Watchpoint;
+            draining = true;
+        }
+        // Unit-stride streams a datapath's width per cycle, strided one element
+        busy = mop == 0 ? vector_unit.cycles(eew) : std::max<uint32_t>(1, vl);
+        return 0;
+    } else {
+        (void)instr, (void)base, (void)stride, (void)busy, (void)tval;
+        return CAUSE_ILLEGAL_INSTRUCTION;
+    }
+}
+
 // --- Other Methods (unchanged for now, but execute_* are gone) ---
 
-void CPU::trap(uint32_t cause, uint32_t trap_pc, uint32_t tval) {
-    csrs[CSR_MCAUSE] = cause;
-    csrs[CSR_MEPC] = trap_pc;
-    csrs[CSR_MTVAL] = tval;
-    pc = csrs.count(CSR_MTVEC) ? csrs[CSR_MTVEC] : 0;
+template <typename Config>
+void BasicCPU<Config>::trap(uint32_t cause, uint32_t trap_pc, uint32_t tval) {
+    hpm_event(HpmCounters::EVENT_TRAP);
+    uint32_t code = cause & ~CAUSE_INTERRUPT;
+    uint32_t deleg = get_csr((cause & CAUSE_INTERRUPT) ? CSR_MIDELEG : CSR_MEDELEG);
+    uint32_t status = get_csr(CSR_MSTATUS);
+    uint32_t tvec;
+    if (priv <= PRIV_S && code < 32 && ((deleg >> code) & 1)) {
+        csrs[CSR_SCAUSE] = cause;
+        csrs[CSR_SEPC] = trap_pc;
+        csrs[CSR_STVAL] = tval;
+        status = (status & ~(MSTATUS_SPIE | MSTATUS_SIE | MSTATUS_SPP)) |
+                 ((status & MSTATUS_SIE) ? MSTATUS_SPIE : 0) | (priv << 8);
+        priv = PRIV_S;
+        tvec = get_csr(CSR_STVEC);
+    } else {
+        csrs[CSR_MCAUSE] = cause;
+        csrs[CSR_MEPC] = trap_pc;
+        csrs[CSR_MTVAL] = tval;
+        status = (status & ~(MSTATUS_MPIE | MSTATUS_MIE | MSTATUS_MPP)) |
+                 ((status & MSTATUS_MIE) ? MSTATUS_MPIE : 0) | (priv << 11);
+        priv = PRIV_M;
+        tvec = get_csr(CSR_MTVEC);
+    }
+    csrs[CSR_MSTATUS] = status;
+    update_translation();
+    // Vectored mode only applies to interrupts
+    pc = ((tvec & 0x3) == 1 && (cause & CAUSE_INTERRUPT)) ? (tvec & ~0x3u) + 4 * code : tvec & ~0x3u;
+}
+
+template <typename Config>
+void BasicCPU<Config>::trap_return(uint8_t from) {
+    uint32_t status = get_csr(CSR_MSTATUS);
+    if (from == PRIV_M) {
+        priv = (status & MSTATUS_MPP) >> 11;
+        status = (status & ~(MSTATUS_MIE | MSTATUS_MPP)) | ((status & MSTATUS_MPIE) ? MSTATUS_MIE : 0) | MSTATUS_MPIE;
+        pc = get_csr(CSR_MEPC);
+    } else {
+        priv = (status & MSTATUS_SPP) >> 8;
+        status = (status & ~(MSTATUS_SIE | MSTATUS_SPP)) | ((status & MSTATUS_SPIE) ? MSTATUS_SIE : 0) | MSTATUS_SPIE;
+        pc = get_csr(CSR_SEPC);
+    }
+    if (priv == 2) priv = PRIV_U; // Reserved MPP value
+    if (priv != PRIV_M) status &= ~MSTATUS_MPRV;
+    csrs[CSR_MSTATUS] = status;
+    update_translation();
+}
+
+// Picks the highest priority pending and enabled interrupt, honouring mideleg
+// Runs the device poll callback, which may raise lines; returns the lines after it
+template <typename Config>
+uint32_t BasicCPU<Config>::poll_devices() {
+    irq_lines.fetch_and(~IRQ_DEVICE_POLL, std::memory_order_acquire);
+    if (device_poll) device_poll();
+    return irq_lines.load(std::memory_order_acquire);
+}
+
+template <typename Config>
+bool BasicCPU<Config>::interrupt_pending(uint32_t& cause) const {
+    static constexpr uint32_t PRIORITY[] = {11, 3, 7, 9, 1, 5, 13};
+    uint32_t status = get_csr(CSR_MSTATUS);
+    uint32_t deleg = get_csr(CSR_MIDELEG);
+    uint32_t pending = csr_read(CSR_MIP) & get_csr(CSR_MIE);
+    bool m_enabled = priv < PRIV_M || (status & MSTATUS_MIE);
+    bool s_enabled = priv < PRIV_S || (priv == PRIV_S && (status & MSTATUS_SIE));
+    // Interrupts that stay in M-mode go first, whatever their code
+    uint32_t enabled = m_enabled ? pending & ~deleg : 0;
+    if (!enabled) enabled = s_enabled ? pending & deleg : 0;
+    for (uint32_t code : PRIORITY) {
+        if (enabled & (1u << code)) {
+            cause = code;
+            return true;
+        }
+    }
+    return false;
+}
+
+// S-mode CSRs that are views of the M-mode ones; everything else is plain storage
+template <typename Config>
+uint32_t BasicCPU<Config>::csr_read(uint32_t csr_addr) const {
+    if constexpr (Config::vector) {
+        switch (csr_addr) {
+            case CSR_VSTART: return vector_unit.get_vstart();
+            case CSR_VL: return vector_unit.get_vl();
+            case CSR_VTYPE: return vector_unit.get_vtype();
+            case CSR_VLENB: return vector_unit.VLENB;
+        }
+    }
+    switch (csr_addr) {
+        case CSR_SSTATUS: return get_csr(CSR_MSTATUS) & SSTATUS_MASK;
+        case CSR_SIE: return get_csr(CSR_MIE) & get_csr(CSR_MIDELEG);
+        case CSR_SIP: return csr_read(CSR_MIP) & get_csr(CSR_MIDELEG);
+        default: return get_csr(csr_addr);
+    }
+}
+
+template <typename Config>
+void BasicCPU<Config>::csr_write(uint32_t csr_addr, uint32_t value) {
+    if constexpr (Config::vector) {
+        if (csr_addr == CSR_VSTART) {
+            vector_unit.set_vstart(value);
+            return;
+        }
+    }
+    switch (csr_addr) {
+        case CSR_SSTATUS:
+            csrs[CSR_MSTATUS] = (get_csr(CSR_MSTATUS) & ~SSTATUS_MASK) | (value & SSTATUS_MASK);
+            break;
+        case CSR_SIE: {
+            uint32_t deleg = get_csr(CSR_MIDELEG);
+            csrs[CSR_MIE] = (get_csr(CSR_MIE) & ~deleg) | (value & deleg);
+            break;
+        }
+        case CSR_MIP:
+            mip = value & MIP_WRITABLE;
+            break;
+        case CSR_SIP: {
+            uint32_t writable = get_csr(CSR_MIDELEG) & (MIP_SSIP | MIP_LCOFIP);
+            mip = (mip & ~writable) | (value & writable);
+            break;
+        }
+        case CSR_SATP:
+            csrs[CSR_SATP] = value & (SATP_MODE_SV32 | 0x1FF << 22 | 0x3FFFFF); // No ASIDs beyond 9 bits
+            break;
+        default:
+            if (is_counter_csr(csr_addr)) {
+                counter_write(csr_addr, value);
+            } else {
+                csrs[csr_addr] = value;
+            }
+            break;
+    }
+    if (csr_addr == CSR_MSTATUS || csr_addr == CSR_SSTATUS || csr_addr == CSR_SATP) {
+        update_translation();
+    }
+}
+
+// Counter CSRs: mcycle/minstret/mhpmcounterN (and their high halves and
+// user-level shadows), mcountinhibit, mhpmeventN/mhpmeventhN and scountovf
+template <typename Config>
+bool BasicCPU<Config>::is_counter_csr(uint32_t csr_addr) {
+    uint32_t group = csr_addr & 0xF60;
+    return group == 0xB00 || group == 0xC00 || (csr_addr & 0xFE0) == CSR_MCOUNTINHIBIT ||
+           (csr_addr & 0xFE0) == (CSR_MHPMEVENTH3 & 0xFE0) || csr_addr == CSR_SCOUNTOVF;
+}
+
+template <typename Config>
+uint32_t BasicCPU<Config>::counter_read(uint32_t csr_addr) const {
+    int n = csr_addr & 0x1F;
+    if (csr_addr == CSR_SCOUNTOVF) return hpm.overflow_bits() & get_csr(CSR_MCOUNTEREN);
+    if (csr_addr == CSR_MCOUNTINHIBIT) return hpm.get_inhibit();
+    if ((csr_addr & 0xFE0) == CSR_MCOUNTINHIBIT) return n >= 3 ? hpm.get_event(n) : 0;
+    if ((csr_addr & 0xFE0) == (CSR_MHPMEVENTH3 & 0xFE0)) return n >= 3 ? hpm.get_event_high(n) : 0;
+    uint64_t value = hpm.get_counter(n);
+    return (csr_addr & 0x80) ? value >> 32 : value;
+}
+
+template <typename Config>
+void BasicCPU<Config>::counter_write(uint32_t csr_addr, uint32_t value) {
+    int n = csr_addr & 0x1F;
+    if (csr_addr == CSR_MCOUNTINHIBIT) {
+        hpm.set_inhibit(value);
+    } else if ((csr_addr & 0xFE0) == CSR_MCOUNTINHIBIT) {
+        if (n >= 3) hpm.set_event(n, value);
+    } else if ((csr_addr & 0xFE0) == (CSR_MHPMEVENTH3 & 0xFE0)) {
+        if (n >= 3) hpm.set_event_high(n, value);
+    } else if ((csr_addr & 0xF00) == 0xB00 && n != 1) { // No mtime counter
+        uint64_t counter = hpm.get_counter(n);
+        if (csr_addr & 0x80) {
+            counter = (counter & 0xFFFFFFFFull) | (uint64_t)value << 32;
+        } else {
+            counter = (counter & ~0xFFFFFFFFull) | value;
+        }
+        hpm.set_counter(n, counter);
+    }
+}
+
+// User-level counter shadows (and scountovf) below M-mode need their
+// mcounteren bit, and in U-mode also their scounteren bit
+template <typename Config>
+bool BasicCPU<Config>::counter_enabled(uint32_t csr_addr) const {
+    if (priv == PRIV_M || (csr_addr & 0xF60) != 0xC00) return true;
+    uint32_t bit = 1u << (csr_addr & 0x1F);
+    if (!(get_csr(CSR_MCOUNTEREN) & bit)) return false;
+    return priv != PRIV_U || (get_csr(CSR_SCOUNTEREN) & bit);
+}
+
+template <typename Config>
+void BasicCPU<Config>::update_translation() {
+    uint32_t status = get_csr(CSR_MSTATUS);
+    bool sv32 = get_csr(CSR_SATP) & SATP_MODE_SV32;
+    uint8_t data_priv = (priv == PRIV_M && (status & MSTATUS_MPRV)) ? (status & MSTATUS_MPP) >> 11 : priv;
+    translate_fetch = sv32 && priv != PRIV_M;
+    translate_data = sv32 && data_priv != PRIV_M;
+}
+
+// Translates through the TLB, walking the page table on a miss. Returns false
+// on a page fault, leaving paddr untouched.
+template <typename Config>
+bool BasicCPU<Config>::translate(uint32_t vaddr, Access access, uint32_t& paddr) {
+    uint32_t satp = get_csr(CSR_SATP);
+    uint16_t asid = (satp >> 22) & 0x1FF;
+    uint32_t vpn = vaddr >> 12;
+    auto& tlb = access == Access::Fetch ? itlb : dtlb;
+
+    TlbEntry* entry = tlb.lookup(vpn, asid);
+    if (!entry) hpm_event(access == Access::Fetch ? HpmCounters::EVENT_ITLB_MISS : HpmCounters::EVENT_DTLB_MISS);
+    // A store through a clean entry walks again so the walker can set D
+    if (!entry || (access == Access::Store && !(entry->flags & PTE_D))) {
+        uint32_t ppn;
+        uint8_t flags;
+        if (!page_walk(vaddr, access, ppn, flags)) return false;
+        entry = &tlb.insert(vpn, asid, ppn, flags);
+    } else if (!permitted(entry->flags, access)) {
+        return false;
+    }
+    // Physical addresses wider than 32 bits wrap; RAM and devices live below 4 GiB
+    paddr = (entry->ppn << 12) | (vaddr & 0xFFF);
+    return true;
+}
+
+template <typename Config>
+bool BasicCPU<Config>::permitted(uint8_t flags, Access access) const {
+    uint32_t status = get_csr(CSR_MSTATUS);
+    uint8_t effective = (access != Access::Fetch && priv == PRIV_M && (status & MSTATUS_MPRV))
+                      ? (status & MSTATUS_MPP) >> 11 : priv;
+    if (effective == PRIV_U && !(flags & PTE_U)) return false;
+    if (effective == PRIV_S && (flags & PTE_U) && (access == Access::Fetch || !(status & MSTATUS_SUM))) return false;
+    switch (access) {
+        case Access::Fetch: return flags & PTE_X;
+        case Access::Load: return (flags & PTE_R) || ((status & MSTATUS_MXR) && (flags & PTE_X));
+        case Access::Store: return flags & PTE_W;
+    }
+    return false;
+}
+
+// Two-level Sv32 walk. A and D are set in the leaf PTE once the access is
+// known to be permitted. Every level read freezes the pipeline for
+// walk_level_cycles.
+template <typename Config>
+bool BasicCPU<Config>::page_walk(uint32_t vaddr, Access access, uint32_t& ppn, uint8_t& flags) {
+    uint32_t table = get_csr(CSR_SATP) << 12;
+    for (int level = 1; level >= 0; --level) {
+        uint32_t pte_addr = table + ((vaddr >> (12 + 10 * level)) & 0x3FF) * 4;
+        freeze += Config::walk_level_cycles;
+        walk_cycles += Config::walk_level_cycles;
+        hpm_event(HpmCounters::EVENT_WALK_CYCLE, Config::walk_level_cycles);
+        if (pte_addr + 3 >= mem.size()) return false;
+        uint32_t pte = mem.fetch32(pte_addr);
+
+        if (!(pte & PTE_V) || (!(pte & PTE_R) && (pte & PTE_W))) return false;
+        if (!(pte & (PTE_R | PTE_X))) {
+            table = (pte >> 10) << 12; // Pointer to the next level
+            continue;
+        }
+        if (level == 1 && ((pte >> 10) & 0x3FF)) return false; // Misaligned megapage
+        if (!permitted(pte & 0xFF, access)) return false;
+
+        uint32_t needed = PTE_A | (access == Access::Store ? PTE_D : 0);
+        if ((pte & needed) != needed) {
+            pte |= needed;
+            mem.write32(pte_addr, pte);
+        }
+        ppn = level == 1 ? ((pte >> 20) << 10) | ((vaddr >> 12) & 0x3FF) : pte >> 10;
+        flags = pte & 0xFF;
+        return true;
+    }
+    return false;
 }
 
-int32_t CPU::sign_extend(uint32_t value, int bits) {
+template <typename Config>
+int32_t BasicCPU<Config>::sign_extend(uint32_t value, int bits) {
     if (value & (1 << (bits - 1))) {
         return (int32_t)(value | (0xFFFFFFFF << bits));
     }
     return (int32_t)value;
 }
 
-void CPU::dump_registers() const {
+template <typename Config>
+void BasicCPU<Config>::trace_retire() const {
+    std::cout << "[trace] 0x" << std::hex << std::setw(8) << std::setfill('0') << mem_wb_reg.pc
+              << ": 0x" << std::setw(8) << mem_wb_reg.instruction;
+    if (mem_wb_reg.controls.reg_write && mem_wb_reg.rd != 0) {
+        std::cout << "  x" << std::dec << (int)mem_wb_reg.rd << " <- 0x" << std::hex << std::setw(8)
+                  << regs[mem_wb_reg.rd];
+    }
+    std::cout << std::dec << std::endl;
+}
+
+template <typename Config>
+void BasicCPU<Config>::notify_retire() const {
+    if (!retire_observer) return;
+    RetireInfo info;
+    info.pc = mem_wb_reg.pc;
+    info.instruction = mem_wb_reg.instruction;
+    if (mem_wb_reg.controls.reg_write && mem_wb_reg.rd != 0) {
+        info.rd = mem_wb_reg.rd;
+        info.rd_value = regs[mem_wb_reg.rd];
+    }
+    if (mem_wb_reg.controls.mem_write) {
+        info.store_size = access_bytes(mem_wb_reg.controls.funct3);
+        info.store_addr = mem_wb_reg.alu_result;
+        info.store_value = info.store_size == 4 ? mem_wb_reg.store_data
+                         : mem_wb_reg.store_data & ((1u << (info.store_size * 8)) - 1);
+    }
+    retire_observer(info);
+}
+
+template <typename Config>
+void BasicCPU<Config>::dump_registers() const {
     std::cout << "--- CPU State ---" << std::endl;
     std::cout << "PC: 0x" << std::hex << std::setw(8) << std::setfill('0') << pc << std::endl;
     for (int i = 0; i < 32; ++i) {
@@ -270,13 +1010,173 @@ void CPU::dump_registers() const {
     std::cout << "-----------------" << std::endl;
 }
 
-uint32_t CPU::get_reg(int reg_num) const {
+template <typename Config>
+void BasicCPU<Config>::drain() {
+    draining = true;
+    while (!pipeline_empty()) {
+        clock();
+    }
+}
+
+template <typename Config>
+void BasicCPU<Config>::step_instruction() {
+    drain();
+    draining = false;
+    clock(); // Fetch exactly one instruction
+    drain();
+}
+
+template <typename Config>
+bool BasicCPU<Config>::pipeline_empty() const {
+    bool empty = !if_id_reg.valid && !id_ex_reg.valid && !ex_mem_reg.valid && !mem_wb_reg.valid;
+    if constexpr (Config::store_buffer_entries > 0) {
+        empty = empty && store_buffer.empty();
+    }
+    return empty;
+}
+
+template <typename Config>
+StopReason BasicCPU<Config>::run(uint64_t max_cycles) {
+    if (halted) return StopReason::Halted;
+    pending_stop = StopReason::None;
+    draining = false;
+    for (uint64_t n = 0; n < max_cycles; ++n) {
+        clock();
+        if (pending_stop != StopReason::None || pc >= fetch_limit) {
+            return finish_run(pending_stop);
+        }
+    }
+    return StopReason::CycleLimit;
+}
+
+template <typename Config>
+StopReason BasicCPU<Config>::run_until(uint32_t target_pc, uint64_t max_cycles) {
+    if (halted) return StopReason::Halted;
+    pending_stop = StopReason::None;
+    draining = false;
+    for (uint64_t n = 0; n < max_cycles; ++n) {
+        if (pc == target_pc) {
+            // The fetch may be on a path that an older branch squashes; only a
+            // drained pipeline tells whether target_pc is really next.
+            drain();
+            if (pending_stop != StopReason::None) return finish_run(pending_stop);
+            if (pc == target_pc) return StopReason::PcReached;
+            draining = false;
+        }
+        clock();
+        if (pending_stop != StopReason::None || pc >= fetch_limit) {
+            return finish_run(pending_stop);
+        }
+    }
+    return StopReason::CycleLimit;
+}
+
+template <typename Config>
+StopReason BasicCPU<Config>::step_instructions(uint64_t count) {
+    if (halted) return StopReason::Halted;
+    pending_stop = StopReason::None;
+    draining = false;
+    uint64_t target = instret + count;
+
+    // Run pipelined while everything in flight is sure to fit in the budget
+    while (instret + in_flight() < target) {
+        clock();
+        if (pending_stop != StopReason::None) return finish_run(pending_stop);
+    }
+    drain();
+    while (pending_stop == StopReason::None && instret < target) {
+        step_instruction();
+    }
+    if (pending_stop != StopReason::None) return finish_run(pending_stop);
+    return StopReason::StepDone;
+}
+
+template <typename Config>
+StopReason BasicCPU<Config>::finish_run(StopReason reason) {
+    pending_stop = StopReason::None;
+    if (reason == StopReason::None) {
+        reason = StopReason::FetchLimit;
+    }
+    if (reason != StopReason::Halted) {
+        drain();
+    }
+    return reason;
+}
+
+template <typename Config>
+uint32_t BasicCPU<Config>::in_flight() const {
+    return if_id_reg.valid + id_ex_reg.valid + ex_mem_reg.valid + mem_wb_reg.valid;
+}
+
+template <typename Config>
+void BasicCPU<Config>::save_state(StateWriter& out) const {
+    out.put(regs);
+    out.put(pc);
+    out.put(priv);
+    out.put(halted);
+    out.put(cycles);
+    out.put(instret);
+    out.put(walk_cycles);
+    out.put(freeze);
+    out.put(mip);
+    out.put(hpm);
+    out.put(energy);
+    out.put(lsu_stats);
+    out.put(dcache);
+    if constexpr (Config::vector) {
+        out.put(vector_unit);
+    }
+    out.put<uint32_t>(csrs.size());
+    for (const auto& csr : csrs) {
+        out.put(csr.first);
+        out.put(csr.second);
+    }
+}
+
+template <typename Config>
+bool BasicCPU<Config>::load_state(StateReader& in) {
+    reset();
+    uint32_t csr_count = 0;
+    bool ok = in.get(regs) && in.get(pc) && in.get(priv) && in.get(halted) && in.get(cycles) && in.get(instret) &&
+              in.get(walk_cycles) && in.get(freeze) && in.get(mip) && in.get(hpm) && in.get(energy) && in.get(lsu_stats) &&
+              in.get(dcache);
+    if constexpr (Config::vector) {
+        ok = ok && in.get(vector_unit);
+    }
+    ok = ok && in.get(csr_count);
+    for (uint32_t i = 0; ok && i < csr_count; ++i) {
+        uint32_t addr = 0, value = 0;
+        ok = in.get(addr) && in.get(value);
+        csrs[addr] = value;
+    }
+    if (!ok) {
+        reset();
+        return false;
+    }
+    update_translation();
+    return true;
+}
+
+template <typename Config>
+void BasicCPU<Config>::set_reg(int reg_num, uint32_t value) {
+    if (reg_num <= 0 || reg_num > 31) return;
+    regs[reg_num] = value;
+}
+
+template <typename Config>
+uint32_t BasicCPU<Config>::get_reg(int reg_num) const {
     if (reg_num < 0 || reg_num > 31) return 0;
     return regs[reg_num];
 }
 
-uint32_t CPU::get_csr(uint32_t csr_addr) const {
+template <typename Config>
+uint32_t BasicCPU<Config>::get_csr(uint32_t csr_addr) const {
+    if (csr_addr == CSR_MIP) return mip | (irq_lines.load(std::memory_order_relaxed) & ~IRQ_DEVICE_POLL);
+    if (is_counter_csr(csr_addr)) return counter_read(csr_addr);
     auto it = csrs.find(csr_addr);
     if (it != csrs.end()) return it->second;
     return 0;
 }
+
+#define INSTANTIATE_CPU(Config) template class BasicCPU<Config>;
+FOR_EACH_CORE_CONFIG(INSTANTIATE_CPU)
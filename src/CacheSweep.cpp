@@ -0,0 +1,64 @@
+#include "CacheSweep.hpp"
+#include "MemTrace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+StackDistanceSweep::StackDistanceSweep(uint32_t sets, uint32_t block_size, uint32_t max_ways)
+    : sets(sets), block_shift(0), max_ways(max_ways), stacks(sets * max_ways), depths(sets), hits_at(max_ways) {
+    while ((1u << block_shift) < block_size) block_shift++;
+}
+
+uint64_t StackDistanceSweep::get_misses(uint32_t ways) const {
+    uint64_t hits = 0;
+    for (uint32_t d = 0; d < std::min(ways, max_ways); ++d) hits += hits_at[d];
+    return accesses - hits;
+}
+
+bool sweep_trace(const std::string& path, const std::vector<uint32_t>& block_sizes, const std::vector<uint32_t>& set_counts,
+                 uint32_t max_ways, unsigned threads, std::vector<SweepResult>& results, std::string& error) {
+    {
+        MemTraceReader probe;
+        if (!probe.open(path)) {
+            error = "could not read trace " + path;
+            return false;
+        }
+    }
+
+    std::vector<StackDistanceSweep> sweeps;
+    for (uint32_t block_size : block_sizes) {
+        for (uint32_t sets : set_counts) sweeps.emplace_back(sets, block_size, max_ways);
+    }
+    threads = std::max(1u, std::min<unsigned>(threads, sweeps.size()));
+
+    // Thread t replays the trace into sweeps t, t + threads, ...
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            MemTraceReader reader;
+            if (!reader.open(path)) {
+                failed = true;
+                return;
+            }
+            uint32_t address;
+            bool is_write;
+            while (reader.next(address, is_write)) {
+                for (size_t i = t; i < sweeps.size(); i += threads) sweeps[i].access(address);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    if (failed) {
+        error = "could not read trace " + path;
+        return false;
+    }
+
+    results.clear();
+    for (const StackDistanceSweep& sweep : sweeps) {
+        for (uint32_t ways = 1; ways <= max_ways; ++ways) {
+            results.push_back({sweep.get_block_size(), sweep.get_sets(), ways, sweep.get_accesses(), sweep.get_misses(ways)});
+        }
+    }
+    return true;
+}
@@ -0,0 +1,298 @@
+#include "Checkpoint.hpp"
+#include "Memory.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr char MAGIC[8] = {'R', 'V', 'C', 'K', 'P', 'T', '0', '4'};
+
+uint64_t fnv1a(const uint8_t* data, size_t size) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+std::string file_name(const std::string& dir, uint32_t sequence, const char* suffix) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "/ckpt-%06u%s", sequence, suffix);
+    return dir + name;
+}
+
+// Sequence numbers of the ckpt-NNNNNN.bin files in dir, ascending
+std::vector<uint32_t> list_checkpoints(const std::string& dir) {
+    std::vector<uint32_t> found;
+    DIR* d = opendir(dir.c_str());
+    if (!d) return found;
+    while (dirent* entry = readdir(d)) {
+        unsigned sequence;
+        char tail;
+        if (std::strlen(entry->d_name) == 15 && std::sscanf(entry->d_name, "ckpt-%6u.bi%c", &sequence, &tail) == 2 && tail == 'n') {
+            found.push_back(sequence);
+        }
+    }
+    closedir(d);
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+struct Parsed {
+    bool full = false;
+    std::string config;
+    uint32_t mem_size = 0;
+    std::vector<uint8_t> state;
+    const uint8_t* pages = nullptr; // Page records, parsed again when applied
+    uint32_t page_count = 0;
+};
+
+// Checks the framing and checksum of one file
+bool parse(const std::vector<uint8_t>& blob, uint32_t sequence, Parsed& out) {
+    if (blob.size() < sizeof(MAGIC) + 8) return false;
+    size_t body = blob.size() - 8;
+    uint64_t checksum;
+    std::memcpy(&checksum, &blob[body], 8);
+    if (checksum != fnv1a(blob.data(), body) || std::memcmp(blob.data(), MAGIC, sizeof(MAGIC)) != 0) return false;
+
+    StateReader in(blob.data() + sizeof(MAGIC), body - sizeof(MAGIC));
+    uint32_t stored_sequence, config_len, state_len;
+    uint8_t full;
+    if (!in.get(stored_sequence) || stored_sequence != sequence || !in.get(full) || !in.get(config_len) ||
+        config_len > in.remaining()) {
+        return false;
+    }
+    out.full = full;
+    out.config.assign(config_len, '\0');
+    if (!in.get_bytes(&out.config[0], config_len) || !in.get(out.mem_size) || !in.get(state_len) || state_len > in.remaining()) {
+        return false;
+    }
+    out.state.resize(state_len);
+    if (!in.get_bytes(out.state.data(), state_len) || !in.get(out.page_count)) return false;
+    out.pages = in.peek();
+    return true;
+}
+
+} // namespace
+
+Checkpointer::Checkpointer(Memory& mem, const std::string& dir, const std::string& config)
+    : mem(mem), dir(dir), config(config) {}
+
+Checkpointer::~Checkpointer() {
+    if (!writer.joinable()) return;
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_cv.notify_all();
+    writer.join();
+}
+
+bool Checkpointer::open() {
+    if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Checkpoint: could not create " << dir << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    first_sequence = sequence;
+    writer = std::thread(&Checkpointer::writer_loop, this);
+    return true;
+}
+
+void Checkpointer::capture(std::vector<uint8_t> cpu_state) {
+    auto start = std::chrono::steady_clock::now();
+    bool full = false;
+    {
+        // Backpressure: at most two checkpoints' worth of pages in memory
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        done_cv.wait(lock, [this] { return queue.size() < 2; });
+        full = full || need_full;
+        need_full = false;
+    }
+
+    uint32_t seq = ++sequence;
+    full = full || seq % FULL_EVERY == 1;
+    StateWriter out;
+    out.put_bytes(MAGIC, sizeof(MAGIC));
+    out.put(seq);
+    out.put<uint8_t>(full);
+    out.put<uint32_t>(config.size());
+    out.put_bytes(config.data(), config.size());
+    out.put(mem.size());
+    out.put<uint32_t>(cpu_state.size());
+    out.put_bytes(cpu_state.data(), cpu_state.size());
+
+    const uint32_t page_size = 1u << Memory::PAGE_SHIFT;
+    size_t count_at = out.data.size();
+    uint32_t count = 0;
+    out.put(count);
+    for (uint32_t page = 0; page < mem.page_count(); ++page) {
+        if (!full && !mem.is_dirty(page, Memory::DIRTY_CHECKPOINT)) continue;
+        uint32_t start_addr = page << Memory::PAGE_SHIFT;
+        uint32_t length = std::min(page_size, mem.size() - start_addr);
+        out.put(page);
+        out.put_bytes(mem.dma(start_addr, length, false), length);
+        count++;
+    }
+    std::memcpy(&out.data[count_at], &count, sizeof(count));
+    mem.clear_dirty(Memory::DIRTY_CHECKPOINT);
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        queue.push_back({seq, full, std::move(out.data)});
+    }
+    queue_cv.notify_one();
+    capture_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Checkpointer::flush() {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    done_cv.wait(lock, [this] { return queue.empty() && !writing; });
+}
+
+uint64_t Checkpointer::get_bytes_written() const {
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    return bytes_written;
+}
+
+void Checkpointer::writer_loop() {
+    for (;;) {
+        Pending pending;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) return;
+            pending = std::move(queue.front());
+            queue.pop_front();
+            writing = true;
+        }
+        bool ok = write_file(pending);
+        // Older files are only redundant once the full checkpoint is on disk
+        if (ok && pending.full) remove_older(pending.sequence);
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (ok) bytes_written += pending.blob.size() + 8;
+            else need_full = true; // Later incrementals would build on the missing one
+            writing = false;
+        }
+        done_cv.notify_all();
+    }
+}
+
+bool Checkpointer::write_file(const Pending& pending) {
+    std::string tmp = file_name(dir, pending.sequence, ".tmp");
+    std::string final_name = file_name(dir, pending.sequence, ".bin");
+    uint64_t checksum = fnv1a(pending.blob.data(), pending.blob.size());
+
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    bool ok = fd >= 0;
+    const uint8_t* parts[2] = {pending.blob.data(), reinterpret_cast<const uint8_t*>(&checksum)};
+    size_t sizes[2] = {pending.blob.size(), sizeof(checksum)};
+    for (int i = 0; ok && i < 2; ++i) {
+        for (size_t done = 0; ok && done < sizes[i];) {
+            ssize_t n = ::write(fd, parts[i] + done, sizes[i] - done);
+            if (n < 0 && errno == EINTR) continue;
+            ok = n > 0;
+            if (ok) done += n;
+        }
+    }
+    // Data durable before the name, name durable before the next checkpoint
+    ok = ok && fsync(fd) == 0;
+    if (fd >= 0) ok = close(fd) == 0 && ok;
+    ok = ok && rename(tmp.c_str(), final_name.c_str()) == 0;
+    if (ok) {
+        int dir_fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+        ok = dir_fd >= 0 && fsync(dir_fd) == 0;
+        if (dir_fd >= 0) close(dir_fd);
+    }
+    if (!ok) {
+        std::cerr << "Checkpoint: could not write " << final_name << ": " << std::strerror(errno) << std::endl;
+        unlink(tmp.c_str());
+    }
+    return ok;
+}
+
+void Checkpointer::remove_older(uint32_t last) {
+    for (uint32_t seq : list_checkpoints(dir)) {
+        if (seq < last) unlink(file_name(dir, seq, ".bin").c_str());
+    }
+}
+
+bool Checkpointer::resume(const std::string& dir, const std::string& config, Memory& mem,
+                          std::vector<uint8_t>& cpu_state, uint32_t& sequence, std::string& error) {
+    std::vector<uint32_t> found = list_checkpoints(dir);
+    std::vector<std::vector<uint8_t>> blobs(found.size());
+    std::vector<Parsed> parsed(found.size());
+    std::vector<bool> valid(found.size());
+    for (size_t i = 0; i < found.size(); ++i) {
+        std::ifstream file(file_name(dir, found[i], ".bin"), std::ios::binary);
+        blobs[i].assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        valid[i] = parse(blobs[i], found[i], parsed[i]);
+    }
+
+    // Newest chain: a full checkpoint followed by consecutive valid ones
+    long chain_start = -1, chain_end = -1, start = -1;
+    for (size_t i = 0; i < found.size(); ++i) {
+        if (!valid[i]) {
+            start = -1;
+        } else if (parsed[i].full) {
+            start = i;
+        } else if (start < 0 || found[i] != found[i - 1] + 1) {
+            start = -1;
+        }
+        if (start >= 0) {
+            chain_start = start;
+            chain_end = i;
+        }
+    }
+    if (chain_start < 0) {
+        error = "no complete checkpoint in " + dir;
+        return false;
+    }
+    const Parsed& last = parsed[chain_end];
+    if (last.config != config) {
+        error = "checkpoint was taken with --config " + last.config;
+        return false;
+    }
+    if (last.mem_size != mem.size()) {
+        error = "checkpoint memory size does not match";
+        return false;
+    }
+
+    const uint32_t page_size = 1u << Memory::PAGE_SHIFT;
+    for (long i = chain_start; i <= chain_end; ++i) {
+        const Parsed& p = parsed[i];
+        StateReader in(p.pages, blobs[i].data() + blobs[i].size() - 8 - p.pages);
+        for (uint32_t n = 0; n < p.page_count; ++n) {
+            uint32_t page;
+            if (!in.get(page) || page >= mem.page_count()) {
+                error = "corrupt page record in " + file_name(dir, found[i], ".bin");
+                return false;
+            }
+            uint32_t start_addr = page << Memory::PAGE_SHIFT;
+            uint32_t length = std::min(page_size, mem.size() - start_addr);
+            if (!in.get_bytes(mem.dma(start_addr, length, true), length)) {
+                error = "truncated page in " + file_name(dir, found[i], ".bin");
+                return false;
+            }
+        }
+    }
+    mem.clear_dirty(Memory::DIRTY_CHECKPOINT);
+    cpu_state = last.state;
+    sequence = found[chain_end];
+
+    // Later files are not part of the chain; new checkpoints replace them
+    for (size_t i = chain_end + 1; i < found.size(); ++i) {
+        unlink(file_name(dir, found[i], ".bin").c_str());
+    }
+    return true;
+}
@@ -0,0 +1,76 @@
+#include "Energy.hpp"
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+const char* const alu_names[EnergyCounters::ALU_OPS] = {
+    "lui", "auipc", "jal", "jalr", "branch", "load", "store", "op-imm", "op", "system", "vector", "fence"
+};
+
+double* table_entry(EnergyTable& table, const std::string& name) {
+    if (name == "fetch") return &table.fetch;
+    if (name == "reg_read") return &table.reg_read;
+    if (name == "reg_write") return &table.reg_write;
+    if (name == "dcache_hit") return &table.dcache_hit;
+    if (name == "dcache_miss") return &table.dcache_miss;
+    if (name == "mem_byte") return &table.mem_byte;
+    if (name == "flush") return &table.flush;
+    if (name == "stall") return &table.stall;
+    if (name == "leakage") return &table.leakage;
+    if (name == "clock_mhz") return &table.clock_mhz;
+    for (int i = 0; i < EnergyCounters::ALU_OPS; ++i) {
+        if (name == std::string("alu.") + alu_names[i]) return &table.alu[i];
+    }
+    return nullptr;
+}
+
+} // namespace
+
+bool load_energy_table(const std::string& path, EnergyTable& table, std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::string line;
+    for (int number = 1; std::getline(file, line); ++number) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name)) continue; // Blank or comment
+        double* entry = table_entry(table, name);
+        double value;
+        std::string rest;
+        if (!entry || !(fields >> value) || value < 0 || (fields >> rest)) {
+            error = path + ":" + std::to_string(number) + ": bad entry '" + name + "'";
+            return false;
+        }
+        *entry = value;
+    }
+    if (table.clock_mhz <= 0) {
+        error = path + ": clock_mhz must be positive";
+        return false;
+    }
+    return true;
+}
+
+EnergyReport estimate_energy(const EnergyCounters& c, const EnergyTable& t) {
+    EnergyReport r;
+    r.stage[0] = c.fetches * t.fetch;
+    r.stage[1] = c.reg_reads * t.reg_read;
+    for (int i = 0; i < EnergyCounters::ALU_OPS; ++i) {
+        r.stage[2] += c.alu_ops[i] * t.alu[i];
+    }
+    r.stage[3] = c.dcache_hits * t.dcache_hit + c.dcache_misses * t.dcache_miss + c.mem_bytes * t.mem_byte;
+    r.stage[4] = c.reg_writes * t.reg_write;
+    r.control = c.flushes * t.flush + c.stall_cycles * t.stall;
+    r.leakage = c.cycles * t.leakage;
+
+    r.total = r.control + r.leakage;
+    for (double e : r.stage) r.total += e;
+    // pJ per cycle times cycles per microsecond gives microwatts
+    r.power_mw = c.cycles ? r.total / c.cycles * t.clock_mhz / 1000.0 : 0;
+    r.per_instruction = c.instret ? r.total / c.instret : 0;
+    return r;
+}
@@ -0,0 +1,42 @@
+#include "FuzzHarness.hpp"
+#include <fstream>
+
+FuzzHarness::FuzzHarness(const std::vector<uint32_t>& firmware, uint32_t input_addr, uint32_t input_max,
+                         uint64_t max_cycles, uint32_t mem_size)
+    : mem(mem_size), cpu(mem), input_addr(input_addr), input_max(input_max), max_cycles(max_cycles) {
+    mem.map_mmio(CRASH_BASE, 4, nullptr, [this](uint32_t, uint32_t, uint32_t) {
+        crashed = true;
+        cpu.request_stop();
+    });
+    mem.load_program(firmware);
+    mem.snapshot();
+}
+
+FuzzHarness::Outcome FuzzHarness::run(const uint8_t* data, size_t size) {
+    execs++;
+    mem.restore_snapshot();
+    cpu.reset();
+    crashed = false;
+
+    uint32_t length = size < input_max ? static_cast<uint32_t>(size) : input_max;
+    for (uint32_t i = 0; i < length; ++i) {
+        mem.debug_write8(input_addr + i, data[i]);
+    }
+    cpu.set_reg(10, input_addr);
+    cpu.set_reg(11, length);
+
+    uint64_t bus_errors = mem.get_bus_errors();
+    StopReason reason = cpu.run(max_cycles);
+    if (crashed || mem.get_bus_errors() != bus_errors) return Outcome::Crash;
+    if (reason == StopReason::CycleLimit) return Outcome::Timeout;
+    return Outcome::Ok;
+}
+
+bool FuzzHarness::read_firmware(const std::string& path, std::vector<uint32_t>& words) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    std::streamsize size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    words.assign((size + 3) / 4, 0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(words.data()), size));
+}
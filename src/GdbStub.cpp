@@ -0,0 +1,441 @@
+#include "GdbStub.hpp"
+#include "CPU.hpp"
+#include "Memory.hpp"
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace {
+
+const char HEX_DIGITS[] = "0123456789abcdef";
+
+int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+void append_hex8(std::string& out, uint8_t value) {
+    out += HEX_DIGITS[value >> 4];
+    out += HEX_DIGITS[value & 0xF];
+}
+
+// Registers travel in target (little-endian) byte order
+void append_hex32_le(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) append_hex8(out, (value >> (i * 8)) & 0xFF);
+}
+
+bool parse_hex32_le(const std::string& hex, size_t pos, uint32_t& value) {
+    if (pos + 8 > hex.size()) return false;
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+        int hi = hex_value(hex[pos + i * 2]);
+        int lo = hex_value(hex[pos + i * 2 + 1]);
+        if (hi < 0 || lo < 0) return false;
+        value |= (uint32_t)((hi << 4) | lo) << (i * 8);
+    }
+    return true;
+}
+
+// Parses a big-endian hex number such as an address or length
+bool parse_hex(const std::string& s, uint32_t& value) {
+    if (s.empty()) return false;
+    value = 0;
+    for (char c : s) {
+        int v = hex_value(c);
+        if (v < 0) return false;
+        value = (value << 4) | v;
+    }
+    return true;
+}
+
+} // namespace
+
+template <typename Config>
+GdbStub<Config>::GdbStub(BasicCPU<Config>& cpu, Memory& mem) : cpu(cpu), mem(mem) {}
+
+template <typename Config>
+GdbStub<Config>::~GdbStub() {
+    close_client();
+    if (listen_fd >= 0) close(listen_fd);
+    if (!unix_path.empty()) unlink(unix_path.c_str());
+}
+
+template <typename Config>
+bool GdbStub<Config>::listen(const std::string& address) {
+    if (address.rfind("unix:", 0) == 0) {
+        unix_path = address.substr(5);
+        sockaddr_un addr{};
+        if (unix_path.empty() || unix_path.size() >= sizeof(addr.sun_path)) {
+            std::cerr << "GDB: invalid socket path " << unix_path << std::endl;
+            return false;
+        }
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, unix_path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(unix_path.c_str());
+        listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd < 0 || bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+            std::cerr << "GDB: could not bind " << unix_path << ": " << std::strerror(errno) << std::endl;
+            return false;
+        }
+    } else {
+        // Bare port numbers bind to loopback only
+        std::string host = "127.0.0.1";
+        std::string port = address;
+        size_t colon = address.rfind(':');
+        if (colon != std::string::npos) {
+            host = address.substr(0, colon);
+            port = address.substr(colon + 1);
+        }
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* res = nullptr;
+        if (getaddrinfo(host.c_str(), port.c_str(), &hints, &res) != 0 || !res) {
+            std::cerr << "GDB: could not resolve " << address << std::endl;
+            return false;
+        }
+        listen_fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+        int one = 1;
+        if (listen_fd >= 0) setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        bool bound = listen_fd >= 0 && bind(listen_fd, res->ai_addr, res->ai_addrlen) == 0;
+        freeaddrinfo(res);
+        if (!bound) {
+            std::cerr << "GDB: could not bind " << address << ": " << std::strerror(errno) << std::endl;
+            return false;
+        }
+    }
+    if (::listen(listen_fd, 1) < 0) {
+        std::cerr << "GDB: listen failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    std::cout << "Waiting for GDB connection on " << address << "..." << std::endl;
+    return true;
+}
+
+template <typename Config>
+void GdbStub<Config>::serve() {
+    client_fd = accept(listen_fd, nullptr, nullptr);
+    if (client_fd < 0) {
+        std::cerr << "GDB: accept failed: " << std::strerror(errno) << std::endl;
+        return;
+    }
+    int one = 1;
+    setsockopt(client_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    std::cout << "GDB connected." << std::endl;
+
+    cpu.set_debug_attached(true);
+    cpu.drain();
+    detach_requested = false;
+
+    std::string packet;
+    while (!kill_requested && !detach_requested && read_packet(packet)) {
+        std::string reply = handle_packet(packet);
+        if (client_fd >= 0) send_packet(reply);
+    }
+
+    remove_all_breakpoints();
+    mem.clear_watchpoints();
+    cpu.set_debug_attached(false);
+    cpu.resume();
+    close_client();
+    std::cout << "GDB detached." << std::endl;
+}
+
+template <typename Config>
+bool GdbStub<Config>::read_packet(std::string& packet) {
+    char c;
+    // Skip acks and stray interrupts until the start of a packet
+    do {
+        if (recv(client_fd, &c, 1, 0) <= 0) return false;
+    } while (c != '$');
+
+    packet.clear();
+    while (true) {
+        if (recv(client_fd, &c, 1, 0) <= 0) return false;
+        if (c == '#') break;
+        packet += c;
+    }
+    char checksum[2];
+    for (char& d : checksum) {
+        if (recv(client_fd, &d, 1, 0) <= 0) return false;
+    }
+
+    uint8_t sum = 0;
+    for (char d : packet) sum += (uint8_t)d;
+    bool ok = hex_value(checksum[0]) == (sum >> 4) && hex_value(checksum[1]) == (sum & 0xF);
+    char ack = ok ? '+' : '-';
+    send(client_fd, &ack, 1, MSG_NOSIGNAL);
+    return ok ? true : read_packet(packet);
+}
+
+template <typename Config>
+void GdbStub<Config>::send_packet(const std::string& payload) {
+    uint8_t sum = 0;
+    for (char c : payload) sum += (uint8_t)c;
+    std::string frame = "$" + payload + "#";
+    append_hex8(frame, sum);
+    send(client_fd, frame.data(), frame.size(), MSG_NOSIGNAL);
+}
+
+template <typename Config>
+bool GdbStub<Config>::interrupt_pending() {
+    pollfd pfd{client_fd, POLLIN, 0};
+    if (poll(&pfd, 1, 0) <= 0) return false;
+    char c;
+    if (recv(client_fd, &c, 1, 0) <= 0) {
+        detach_requested = true; // Debugger went away
+        return true;
+    }
+    return c == 0x03;
+}
+
+template <typename Config>
+std::string GdbStub<Config>::handle_packet(const std::string& packet) {
+    if (packet.empty()) return "";
+    std::string args = packet.substr(1);
+
+    switch (packet[0]) {
+        case '?': return stop_reply(SIGTRAP);
+        case 'g': return read_registers();
+        case 'G': return write_registers(args);
+        case 'm': return read_memory(args);
+        case 'M': return write_memory(args);
+        case 'c': return resume(false);
+        case 's': return resume(true);
+        case 'Z': return set_breakpoint(args, true);
+        case 'z': return set_breakpoint(args, false);
+        case 'H': return "OK";
+        case 'p': {
+            uint32_t reg;
+            if (!parse_hex(args, reg) || reg >= NUM_REGS) return "E01";
+            std::string out;
+            append_hex32_le(out, reg == 32 ? cpu.fetch_pc() : cpu.get_reg(reg));
+            return out;
+        }
+        case 'P': {
+            size_t eq = args.find('=');
+            uint32_t reg, value;
+            if (eq == std::string::npos || !parse_hex(args.substr(0, eq), reg) ||
+                !parse_hex32_le(args, eq + 1, value) || reg >= NUM_REGS) return "E01";
+            if (reg == 32) cpu.set_pc(value);
+            else cpu.set_reg(reg, value);
+            return "OK";
+        }
+        case 'D':
+            detach_requested = true;
+            return "OK";
+        case 'k':
+            kill_requested = true;
+            close_client();
+            return "";
+        case 'q':
+            if (args.rfind("Supported", 0) == 0) return "PacketSize=4000;swbreak+;hwbreak+";
+            if (args == "Attached") return "1";
+            if (args == "C") return "QC1";
+            if (args == "fThreadInfo") return "m1";
+            if (args == "sThreadInfo") return "l";
+            return "";
+        default:
+            return ""; // Unsupported
+    }
+}
+
+template <typename Config>
+std::string GdbStub<Config>::resume(bool single_step) {
+    StopReason reason;
+    if (single_step) {
+        reason = cpu.step_instructions(1);
+    } else {
+        // Run in bounded slices so a ^C from the debugger is noticed promptly
+        while ((reason = cpu.run(POLL_INTERVAL)) == StopReason::CycleLimit) {
+            if (interrupt_pending()) {
+                cpu.drain();
+                return stop_reply(SIGINT);
+            }
+        }
+    }
+
+    uint32_t watch_addr;
+    uint8_t watch_kind;
+    bool watch_stop = mem.take_watch_hit(watch_addr, watch_kind);
+
+    if (reason == StopReason::Halted) {
+        std::string reply = "W";
+        append_hex8(reply, cpu.get_reg(10) & 0xFF); // a0 is the exit code
+        return reply;
+    }
+    if (watch_stop) {
+        std::string reply = "T05";
+        reply += (watch_kind == Memory::WATCH_WRITE) ? "watch:" : "rwatch:";
+        char buf[9];
+        std::snprintf(buf, sizeof(buf), "%x", watch_addr);
+        return reply + buf + ";";
+    }
+    if (reason == StopReason::Breakpoint) {
+        // Stops on our own patches carry the reason GDB asked for in qSupported;
+        // an EBREAK the guest was built with stays a plain SIGTRAP
+        uint32_t pc = cpu.fetch_pc();
+        if (breakpoints.count(pc)) return hw_breakpoints.count(pc) ? "T05hwbreak:;" : "T05swbreak:;";
+    }
+    return stop_reply(SIGTRAP);
+}
+
+template <typename Config>
+std::string GdbStub<Config>::stop_reply(int signal) const {
+    std::string reply = "S";
+    append_hex8(reply, signal);
+    return reply;
+}
+
+template <typename Config>
+std::string GdbStub<Config>::read_registers() const {
+    std::string out;
+    for (uint32_t i = 0; i < 32; ++i) append_hex32_le(out, cpu.get_reg(i));
+    append_hex32_le(out, cpu.fetch_pc());
+    return out;
+}
+
+template <typename Config>
+std::string GdbStub<Config>::write_registers(const std::string& hex) {
+    for (uint32_t i = 0; i < NUM_REGS; ++i) {
+        uint32_t value;
+        if (!parse_hex32_le(hex, i * 8, value)) return "E01";
+        if (i == 32) cpu.set_pc(value);
+        else cpu.set_reg(i, value);
+    }
+    return "OK";
+}
+
+template <typename Config>
+std::string GdbStub<Config>::read_memory(const std::string& args) const {
+    size_t comma = args.find(',');
+    uint32_t addr, len;
+    if (comma == std::string::npos || !parse_hex(args.substr(0, comma), addr) ||
+        !parse_hex(args.substr(comma + 1), len)) return "E01";
+
+    std::string out;
+    for (uint32_t i = 0; i < len; ++i) {
+        uint8_t byte;
+        if (!mem.debug_read8(addr + i, byte)) return i == 0 ? "E14" : out;
+        // Hide our own EBREAKs from the debugger
+        auto bp = breakpoints.upper_bound(addr + i);
+        if (bp != breakpoints.begin() && (--bp)->first + 4 > addr + i) {
+            byte = (bp->second >> ((addr + i - bp->first) * 8)) & 0xFF;
+        }
+        append_hex8(out, byte);
+    }
+    return out;
+}
+
+template <typename Config>
+std::string GdbStub<Config>::write_memory(const std::string& args) {
+    size_t comma = args.find(',');
+    size_t colon = args.find(':');
+    uint32_t addr, len;
+    if (comma == std::string::npos || colon == std::string::npos ||
+        !parse_hex(args.substr(0, comma), addr) ||
+        !parse_hex(args.substr(comma + 1, colon - comma - 1), len) ||
+        args.size() - colon - 1 < len * 2) return "E01";
+
+    for (uint32_t i = 0; i < len; ++i) {
+        int hi = hex_value(args[colon + 1 + i * 2]);
+        int lo = hex_value(args[colon + 2 + i * 2]);
+        if (hi < 0 || lo < 0 || !mem.debug_write8(addr + i, (hi << 4) | lo)) return "E14";
+    }
+    return "OK";
+}
+
+template <typename Config>
+std::string GdbStub<Config>::set_breakpoint(const std::string& args, bool insert) {
+    // Format: type,addr,kind
+    size_t c1 = args.find(',');
+    size_t c2 = args.find(',', c1 + 1);
+    uint32_t type = 0, addr = 0, len = 0;
+    if (c1 == std::string::npos || c2 == std::string::npos ||
+        !parse_hex(args.substr(0, c1), type) ||
+        !parse_hex(args.substr(c1 + 1, c2 - c1 - 1), addr) ||
+        !parse_hex(args.substr(c2 + 1), len)) return "E01";
+
+    bool ok;
+    switch (type) {
+        case 0: case 1: // Software and hardware breakpoints are both EBREAK patches
+            ok = insert ? insert_breakpoint(addr) : remove_breakpoint(addr);
+            if (ok && insert && type == 1) hw_breakpoints.insert(addr);
+            break;
+        case 2: case 3: case 4: {
+            uint8_t kind = type == 2 ? Memory::WATCH_WRITE
+                         : type == 3 ? Memory::WATCH_READ
+                         : Memory::WATCH_READ | Memory::WATCH_WRITE;
+            ok = insert ? mem.add_watchpoint(addr, len, kind) : mem.remove_watchpoint(addr, len, kind);
+            break;
+        }
+        default:
+            return "";
+    }
+    return ok ? "OK" : "E01";
+}
+
+template <typename Config>
+bool GdbStub<Config>::insert_breakpoint(uint32_t address) {
+    if (breakpoints.count(address)) return true;
+    uint8_t probe;
+    if ((address & 3) || !mem.debug_read8(address + 3, probe)) return false;
+    breakpoints[address] = read_word(address);
+    write_word(address, EBREAK);
+    return true;
+}
+
+template <typename Config>
+bool GdbStub<Config>::remove_breakpoint(uint32_t address) {
+    auto it = breakpoints.find(address);
+    if (it == breakpoints.end()) return false;
+    write_word(address, it->second);
+    breakpoints.erase(it);
+    hw_breakpoints.erase(address);
+    return true;
+}
+
+template <typename Config>
+void GdbStub<Config>::remove_all_breakpoints() {
+    for (const auto& bp : breakpoints) write_word(bp.first, bp.second);
+    breakpoints.clear();
+    hw_breakpoints.clear();
+}
+
+template <typename Config>
+uint32_t GdbStub<Config>::read_word(uint32_t address) const {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        uint8_t byte = 0;
+        mem.debug_read8(address + i, byte);
+        value |= (uint32_t)byte << (i * 8);
+    }
+    return value;
+}
+
+template <typename Config>
+void GdbStub<Config>::write_word(uint32_t address, uint32_t value) {
+    for (int i = 0; i < 4; ++i) mem.debug_write8(address + i, (value >> (i * 8)) & 0xFF);
+}
+
+template <typename Config>
+void GdbStub<Config>::close_client() {
+    if (client_fd >= 0) {
+        close(client_fd);
+        client_fd = -1;
+    }
+}
+
+#define INSTANTIATE_GDB_STUB(Config) template class GdbStub<Config>;
+FOR_EACH_CORE_CONFIG(INSTANTIATE_GDB_STUB)
@@ -0,0 +1,47 @@
+#include "MemTrace.hpp"
+#include <cstring>
+
+namespace {
+
+constexpr char MAGIC[8] = {'R', 'V', 'M', 'T', 'R', 'C', '0', '1'};
+
+} // namespace
+
+bool MemTraceWriter::open(const std::string& path) {
+    close();
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+    ok = std::fwrite(MAGIC, sizeof(MAGIC), 1, file) == 1;
+    bytes = sizeof(MAGIC);
+    last = 0;
+    count = 0;
+    return ok;
+}
+
+void MemTraceWriter::flush() {
+    if (file && used) {
+        ok = std::fwrite(buffer.data(), 1, used, file) == used && ok;
+    }
+    bytes += used;
+    used = 0;
+}
+
+bool MemTraceWriter::close() {
+    if (!file) return ok;
+    flush();
+    ok = std::fclose(file) == 0 && ok;
+    file = nullptr;
+    return ok;
+}
+
+bool MemTraceReader::open(const std::string& path) {
+    file = std::fopen(path.c_str(), "rb");
+    char magic[sizeof(MAGIC)];
+    return file && std::fread(magic, sizeof(magic), 1, file) == 1 && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool MemTraceReader::refill() {
+    pos = 0;
+    end = file ? std::fread(buffer.data(), 1, buffer.size(), file) : 0;
+    return end > 0;
+}
@@ -1,17 +1,17 @@
 #include "Memory.hpp"
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 
 Memory::Memory(uint32_t size) {
     mem.resize(size, 0);
+    page_prot.resize((size + (1u << PAGE_SHIFT) - 1) >> PAGE_SHIFT, 0);
+    page_dirty.resize(page_prot.size(), DIRTY_ALL);
 }
 
 uint32_t Memory::read32(uint32_t address) const {
-    if (address == UART_BASE) return 0;
-    if (address + 3 >= mem.size()) {
-        std::cerr << "Memory read out of bounds at 0x" << std::hex << address << std::endl;
-        return 0;
-    }
+    if (address + 3 >= mem.size()) return device_read(address, 4, "read");
+    if (watched(address, 4)) check_watch(address, 4, WATCH_READ);
     // Little-endian read
     return mem[address] | 
            (mem[address + 1] << 8) | 
@@ -19,35 +19,35 @@ uint32_t Memory::read32(uint32_t address) const {
            (mem[address + 3] << 24);
 }
 
+uint32_t Memory::fetch32(uint32_t address) const {
+    if (address + 3 >= mem.size()) return device_read(address, 4, "fetch");
+    return mem[address] |
+           (mem[address + 1] << 8) |
+           (mem[address + 2] << 16) |
+           (mem[address + 3] << 24);
+}
+
 uint16_t Memory::read16(uint32_t address) const {
-    if (address == UART_BASE) return 0;
-    if (address + 1 >= mem.size()) {
-        std::cerr << "Memory read16 out of bounds at 0x" << std::hex << address << std::endl;
-        return 0;
-    }
+    if (address + 1 >= mem.size()) return device_read(address, 2, "read16");
+    if (watched(address, 2)) check_watch(address, 2, WATCH_READ);
     // Little-endian read
     return mem[address] | 
            (mem[address + 1] << 8);
 }
 
 uint8_t Memory::read8(uint32_t address) const {
-    if (address == UART_BASE) return 0;
-    if (address >= mem.size()) {
-        std::cerr << "Memory read8 out of bounds at 0x" << std::hex << address << std::endl;
-        return 0;
-    }
+    if (address >= mem.size()) return device_read(address, 1, "read8");
+    if (watched(address, 1)) check_watch(address, 1, WATCH_READ);
     return mem[address];
 }
 
 void Memory::write32(uint32_t address, uint32_t value) {
-    if (address == UART_BASE) {
-        std::cout << (char)(value & 0xFF) << std::flush;
-        return;
-    }
     if (address + 3 >= mem.size()) {
-        std::cerr << "Memory write out of bounds at 0x" << std::hex << address << std::endl;
+        device_write(address, value, 4, "write");
         return;
     }
+    if (watched(address, 4)) check_watch(address, 4, WATCH_WRITE);
+    mark_dirty(address, 4);
     // Little-endian write
     mem[address]     = value & 0xFF;
     mem[address + 1] = (value >> 8) & 0xFF;
@@ -56,33 +56,163 @@ void Memory::write32(uint32_t address, uint32_t value) {
 }
 
 void Memory::write16(uint32_t address, uint16_t value) {
-    if (address == UART_BASE) {
-        std::cout << (char)(value & 0xFF) << std::flush;
-        return;
-    }
     if (address + 1 >= mem.size()) {
-        std::cerr << "Memory write16 out of bounds at 0x" << std::hex << address << std::endl;
+        device_write(address, value, 2, "write16");
         return;
     }
+    if (watched(address, 2)) check_watch(address, 2, WATCH_WRITE);
+    mark_dirty(address, 2);
     // Little-endian write
     mem[address]     = value & 0xFF;
     mem[address + 1] = (value >> 8) & 0xFF;
 }
 
 void Memory::write8(uint32_t address, uint8_t value) {
-    if (address == UART_BASE) {
-        std::cout << (char)value << std::flush;
-        return;
-    }
     if (address >= mem.size()) {
-        std::cerr << "Memory write8 out of bounds at 0x" << std::hex << address << std::endl;
+        device_write(address, value, 1, "write8");
         return;
     }
+    if (watched(address, 1)) check_watch(address, 1, WATCH_WRITE);
+    mark_dirty(address, 1);
     mem[address] = value;
 }
 
+void Memory::map_mmio(uint32_t base, uint32_t size, MmioRead read, MmioWrite write) {
+    regions.push_back({base, size, std::move(read), std::move(write)});
+}
+
+// Everything outside RAM: the UART, host-registered regions, or a bus error
+uint32_t Memory::device_read(uint32_t address, uint32_t size, const char* what) const {
+    if (address == UART_BASE) return 0;
+    for (const MmioRegion& r : regions) {
+        if (address - r.base < r.size) {
+            return r.read ? r.read(address - r.base, size) : 0;
+        }
+    }
+    bus_errors++;
+    std::cerr << "Memory " << what << " out of bounds at 0x" << std::hex << address << std::endl;
+    return 0;
+}
+
+void Memory::device_write(uint32_t address, uint32_t value, uint32_t size, const char* what) {
+    if (address == UART_BASE) {
+        std::cout << (char)(value & 0xFF) << std::flush;
+        return;
+    }
+    for (const MmioRegion& r : regions) {
+        if (address - r.base < r.size) {
+            if (r.write) r.write(address - r.base, value, size);
+            return;
+        }
+    }
+    bus_errors++;
+    std::cerr << "Memory " << what << " out of bounds at 0x" << std::hex << address << std::endl;
+}
+
 void Memory::load_program(const std::vector<uint32_t>& program, uint32_t start_address) {
     for (size_t i = 0; i < program.size(); ++i) {
         write32(start_address + (i * 4), program[i]);
     }
 }
+
+uint8_t* Memory::dma(uint32_t address, uint32_t length, bool write) {
+    if (length == 0 || address >= mem.size() || length > mem.size() - address) return nullptr;
+    if (write) {
+        for (uint32_t page = address >> PAGE_SHIFT; page <= (address + length - 1) >> PAGE_SHIFT; ++page) {
+            page_dirty[page] = DIRTY_ALL;
+        }
+    }
+    return &mem[address];
+}
+
+bool Memory::debug_read8(uint32_t address, uint8_t& value) const {
+    if (address >= mem.size()) return false;
+    value = mem[address];
+    return true;
+}
+
+bool Memory::debug_write8(uint32_t address, uint8_t value) {
+    if (address >= mem.size()) return false;
+    mark_dirty(address, 1);
+    mem[address] = value;
+    return true;
+}
+
+bool Memory::add_watchpoint(uint32_t address, uint32_t length, uint8_t kind) {
+    if (length == 0 || address >= mem.size() || length > mem.size() - address) return false;
+    watchpoints.push_back({address, length, kind});
+    rebuild_page_prot();
+    return true;
+}
+
+bool Memory::remove_watchpoint(uint32_t address, uint32_t length, uint8_t kind) {
+    auto it = std::find_if(watchpoints.begin(), watchpoints.end(), [&](const Watchpoint& w) {
+        return w.address == address && w.length == length && w.kind == kind;
+    });
+    if (it == watchpoints.end()) return false;
+    watchpoints.erase(it);
+    rebuild_page_prot();
+    return true;
+}
+
+void Memory::clear_watchpoints() {
+    watchpoints.clear();
+    rebuild_page_prot();
+    watch_hit = false;
+}
+
+bool Memory::take_watch_hit(uint32_t& address, uint8_t& kind) {
+    if (!watch_hit) return false;
+    watch_hit = false;
+    address = watch_hit_addr;
+    kind = watch_hit_kind;
+    return true;
+}
+
+void Memory::check_watch(uint32_t address, uint32_t size, uint8_t kind) const {
+    for (const Watchpoint& w : watchpoints) {
+        if ((w.kind & kind) && address < w.address + w.length && w.address < address + size) {
+            // Keep the first hit until the debugger collects it
+            if (!watch_hit) {
+                watch_hit = true;
+                watch_hit_addr = std::max(address, w.address);
+                watch_hit_kind = kind;
+            }
+            return;
+        }
+    }
+}
+
+void Memory::rebuild_page_prot() {
+    std::fill(page_prot.begin(), page_prot.end(), 0);
+    for (const Watchpoint& w : watchpoints) {
+        uint32_t first = w.address >> PAGE_SHIFT;
+        uint32_t last = (w.address + w.length - 1) >> PAGE_SHIFT;
+        for (uint32_t page = first; page <= last; ++page) {
+            page_prot[page] |= w.kind;
+        }
+    }
+}
+
+void Memory::clear_dirty(uint8_t consumer) {
+    for (uint8_t& bits : page_dirty) {
+        bits &= ~consumer;
+    }
+}
+
+void Memory::snapshot() {
+    baseline = mem;
+    clear_dirty(DIRTY_SNAPSHOT);
+}
+
+void Memory::restore_snapshot() {
+    if (baseline.empty()) return;
+    const uint32_t page_size = 1u << PAGE_SHIFT;
+    for (uint32_t page = 0; page < page_dirty.size(); ++page) {
+        if (!(page_dirty[page] & DIRTY_SNAPSHOT)) continue;
+        uint32_t start = page << PAGE_SHIFT;
+        uint32_t length = std::min<uint32_t>(page_size, mem.size() - start);
+        std::memcpy(&mem[start], &baseline[start], length);
+        page_dirty[page] &= ~DIRTY_SNAPSHOT;
+    }
+}
@@ -0,0 +1,161 @@
+#include "Metrics.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+struct Rates {
+    double ipc = 0;
+    double hit_rate = 0;
+    double mips = 0;
+};
+
+Rates rates(const MetricsSample& s, const MetricsSample& prev) {
+    Rates r;
+    uint64_t cycles = s.cycles - prev.cycles;
+    uint64_t instret = s.instret - prev.instret;
+    uint64_t accesses = (s.cache_hits - prev.cache_hits) + (s.cache_misses - prev.cache_misses);
+    double seconds = s.host_seconds - prev.host_seconds;
+    if (cycles) r.ipc = (double)instret / cycles;
+    if (accesses) r.hit_rate = (double)(s.cache_hits - prev.cache_hits) / accesses * 100.0;
+    if (seconds > 0) r.mips = instret / seconds / 1e6;
+    return r;
+}
+
+} // namespace
+
+MetricsSampler::MetricsSampler(const MetricsPublisher& publisher, std::chrono::milliseconds period)
+    : publisher(publisher), period(period) {}
+
+MetricsSampler::~MetricsSampler() {
+    stop();
+    if (listen_fd >= 0) close(listen_fd);
+    if (!unix_path.empty()) unlink(unix_path.c_str());
+}
+
+bool MetricsSampler::open(const std::string& sink) {
+    size_t colon = sink.find(':');
+    std::string kind = sink.substr(0, colon);
+    std::string path = colon == std::string::npos ? "" : sink.substr(colon + 1);
+    if (path.empty() || (kind != "csv" && kind != "json" && kind != "unix")) {
+        std::cerr << "Metrics: expected csv:<file>, json:<file> or unix:<path>, got " << sink << std::endl;
+        return false;
+    }
+
+    if (kind == "unix") {
+        format = Format::Unix;
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) {
+            std::cerr << "Metrics: invalid socket path " << path << std::endl;
+            return false;
+        }
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(path.c_str());
+        listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd < 0 || bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || ::listen(listen_fd, 4) < 0) {
+            std::cerr << "Metrics: could not bind " << path << ": " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        unix_path = path;
+        return true;
+    }
+
+    format = kind == "csv" ? Format::Csv : Format::Json;
+    file.open(path);
+    if (!file.is_open()) {
+        std::cerr << "Metrics: could not open " << path << std::endl;
+        return false;
+    }
+    if (format == Format::Csv) file << "time_s,cycles,instret,ipc,cache_hit_rate,mips" << std::endl;
+    return true;
+}
+
+void MetricsSampler::start() {
+    thread = std::thread(&MetricsSampler::loop, this);
+}
+
+void MetricsSampler::stop() {
+    if (!thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex);
+        stopping = true;
+    }
+    stop_cv.notify_all();
+    thread.join();
+}
+
+void MetricsSampler::loop() {
+    auto next = std::chrono::steady_clock::now() + period;
+    for (;;) {
+        if (format == Format::Unix) {
+            // Answer clients until the next sample is due, checking for stop now and then
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(stop_mutex);
+                    if (stopping) break;
+                }
+                auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(next - std::chrono::steady_clock::now());
+                if (remaining.count() <= 0) break;
+                serve_clients(std::min<int>(remaining.count(), 50));
+            }
+        } else {
+            std::unique_lock<std::mutex> lock(stop_mutex);
+            stop_cv.wait_until(lock, next, [this] { return stopping; });
+        }
+        {
+            std::lock_guard<std::mutex> lock(stop_mutex);
+            if (stopping) break;
+        }
+        sample();
+        next += period;
+    }
+    sample();
+}
+
+void MetricsSampler::sample() {
+    MetricsSample s;
+    uint32_t sequence = publisher.read(s);
+    if (sequence == 0 || sequence == last_sequence) return; // Nothing new published
+    last_sequence = sequence;
+    switch (format) {
+        case Format::Csv: file << format_csv(s, prev) << std::endl; break;
+        case Format::Json: file << format_json(s, prev) << std::endl; break;
+        case Format::Unix: latest = format_json(s, prev) + "\n"; break;
+    }
+    prev = s;
+}
+
+void MetricsSampler::serve_clients(int timeout_ms) {
+    pollfd pfd{listen_fd, POLLIN, 0};
+    if (poll(&pfd, 1, timeout_ms) <= 0) return;
+    int client = accept(listen_fd, nullptr, nullptr);
+    if (client < 0) return;
+    const std::string& reply = latest.empty() ? std::string("{}\n") : latest;
+    send(client, reply.data(), reply.size(), MSG_NOSIGNAL);
+    close(client);
+}
+
+std::string MetricsSampler::format_json(const MetricsSample& s, const MetricsSample& prev) {
+    Rates r = rates(s, prev);
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "{\"time_s\":%.3f,\"cycles\":%llu,\"instret\":%llu,\"ipc\":%.4f,\"cache_hit_rate\":%.2f,\"mips\":%.2f}",
+                  s.host_seconds, (unsigned long long)s.cycles, (unsigned long long)s.instret, r.ipc, r.hit_rate, r.mips);
+    return line;
+}
+
+std::string MetricsSampler::format_csv(const MetricsSample& s, const MetricsSample& prev) {
+    Rates r = rates(s, prev);
+    char line[160];
+    std::snprintf(line, sizeof(line), "%.3f,%llu,%llu,%.4f,%.2f,%.2f", s.host_seconds, (unsigned long long)s.cycles,
+                  (unsigned long long)s.instret, r.ipc, r.hit_rate, r.mips);
+    return line;
+}
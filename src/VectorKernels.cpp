@@ -0,0 +1,85 @@
+#include "VectorKernels.hpp"
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+#if defined(__AVX2__)
+__m256i apply256(VectorOp op, uint32_t sew_bytes, __m256i a, __m256i b) {
+    switch (op) {
+        case VectorOp::Add: return sew_bytes == 1 ? _mm256_add_epi8(a, b) : sew_bytes == 2 ? _mm256_add_epi16(a, b) : _mm256_add_epi32(a, b);
+        case VectorOp::Sub: return sew_bytes == 1 ? _mm256_sub_epi8(a, b) : sew_bytes == 2 ? _mm256_sub_epi16(a, b) : _mm256_sub_epi32(a, b);
+        case VectorOp::And: return _mm256_and_si256(a, b);
+        case VectorOp::Or: return _mm256_or_si256(a, b);
+        case VectorOp::Xor: return _mm256_xor_si256(a, b);
+        case VectorOp::Mul: return sew_bytes == 2 ? _mm256_mullo_epi16(a, b) : _mm256_mullo_epi32(a, b);
+    }
+    return a;
+}
+#endif
+
+#if defined(__SSE2__)
+__m128i apply128(VectorOp op, uint32_t sew_bytes, __m128i a, __m128i b) {
+    switch (op) {
+        case VectorOp::Add: return sew_bytes == 1 ? _mm_add_epi8(a, b) : sew_bytes == 2 ? _mm_add_epi16(a, b) : _mm_add_epi32(a, b);
+        case VectorOp::Sub: return sew_bytes == 1 ? _mm_sub_epi8(a, b) : sew_bytes == 2 ? _mm_sub_epi16(a, b) : _mm_sub_epi32(a, b);
+        case VectorOp::And: return _mm_and_si128(a, b);
+        case VectorOp::Or: return _mm_or_si128(a, b);
+        case VectorOp::Xor: return _mm_xor_si128(a, b);
+        case VectorOp::Mul:
+#if defined(__SSE4_1__)
+            if (sew_bytes == 4) return _mm_mullo_epi32(a, b);
+#endif
+            return _mm_mullo_epi16(a, b);
+    }
+    return a;
+}
+#endif
+
+// The host has no byte multiply, and SSE2 alone no 32-bit one
+bool supported(VectorOp op, uint32_t sew_bytes) {
+    if (op != VectorOp::Mul) return true;
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    return sew_bytes != 1;
+#else
+    return sew_bytes == 2;
+#endif
+}
+
+// Shared loop; b_step is 0 when b points at a broadcast scalar
+size_t apply(VectorOp op, uint32_t sew_bytes, uint8_t* vd, const uint8_t* a, const uint8_t* b, size_t b_step, size_t bytes) {
+    size_t done = 0;
+    if (!supported(op, sew_bytes)) return 0;
+#if defined(__AVX2__)
+    for (; done + 32 <= bytes; done += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + done));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + done * b_step));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(vd + done), apply256(op, sew_bytes, x, y));
+    }
+#endif
+#if defined(__SSE2__)
+    for (; done + 16 <= bytes; done += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + done));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + done * b_step));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(vd + done), apply128(op, sew_bytes, x, y));
+    }
+#else
+    (void)vd, (void)a, (void)b, (void)b_step, (void)bytes;
+#endif
+    return done;
+}
+
+} // namespace
+
+size_t simd_vv(VectorOp op, uint32_t sew_bytes, uint8_t* vd, const uint8_t* vs2, const uint8_t* vs1, size_t bytes) {
+    return apply(op, sew_bytes, vd, vs2, vs1, 1, bytes);
+}
+
+size_t simd_vx(VectorOp op, uint32_t sew_bytes, uint8_t* vd, const uint8_t* vs2, uint32_t scalar, size_t bytes) {
+    alignas(32) uint8_t broadcast[32];
+    for (uint32_t i = 0; i < sizeof(broadcast); ++i) {
+        broadcast[i] = scalar >> (8 * (i % sew_bytes));
+    }
+    return apply(op, sew_bytes, vd, vs2, broadcast, 0, bytes);
+}
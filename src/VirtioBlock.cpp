@@ -0,0 +1,339 @@
+#include "VirtioBlock.hpp"
+#include "Memory.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace {
+// virtio-mmio register offsets
+constexpr uint32_t REG_MAGIC = 0x000, REG_VERSION = 0x004, REG_DEVICE_ID = 0x008, REG_VENDOR_ID = 0x00C;
+constexpr uint32_t REG_DEVICE_FEATURES = 0x010, REG_DEVICE_FEATURES_SEL = 0x014;
+constexpr uint32_t REG_DRIVER_FEATURES = 0x020, REG_DRIVER_FEATURES_SEL = 0x024;
+constexpr uint32_t REG_QUEUE_SEL = 0x030, REG_QUEUE_NUM_MAX = 0x034, REG_QUEUE_NUM = 0x038;
+constexpr uint32_t REG_QUEUE_READY = 0x044, REG_QUEUE_NOTIFY = 0x050;
+constexpr uint32_t REG_INTERRUPT_STATUS = 0x060, REG_INTERRUPT_ACK = 0x064, REG_STATUS = 0x070;
+constexpr uint32_t REG_QUEUE_DESC_LOW = 0x080, REG_QUEUE_DRIVER_LOW = 0x090, REG_QUEUE_DEVICE_LOW = 0x0A0;
+constexpr uint32_t REG_CONFIG_GENERATION = 0x0FC, REG_CONFIG = 0x100;
+
+constexpr uint64_t VIRTIO_F_VERSION_1 = 1ull << 32;
+constexpr uint64_t VIRTIO_BLK_F_FLUSH = 1ull << 9;
+
+constexpr uint16_t VIRTQ_DESC_F_NEXT = 1, VIRTQ_DESC_F_WRITE = 2;
+constexpr uint32_t VIRTIO_BLK_T_IN = 0, VIRTIO_BLK_T_OUT = 1, VIRTIO_BLK_T_FLUSH = 4, VIRTIO_BLK_T_GET_ID = 8;
+constexpr uint8_t VIRTIO_BLK_S_OK = 0, VIRTIO_BLK_S_IOERR = 1, VIRTIO_BLK_S_UNSUPP = 2;
+constexpr uint32_t REQUEST_MALFORMED = ~0u; // Internal: the descriptor chain was invalid
+
+// Guest structures are little-endian
+uint16_t le16(const uint8_t* p) { return p[0] | p[1] << 8; }
+uint32_t le32(const uint8_t* p) { return le16(p) | (uint32_t)le16(p + 2) << 16; }
+uint64_t le64(const uint8_t* p) { return le32(p) | (uint64_t)le32(p + 4) << 32; }
+void put16(uint8_t* p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+void put32(uint8_t* p, uint32_t v) { put16(p, v & 0xFFFF); put16(p + 2, v >> 16); }
+
+// preadv/pwritev until the whole vector is transferred
+bool transfer(int fd, std::vector<iovec> iov, uint64_t offset, bool write) {
+    size_t first = 0;
+    while (first < iov.size()) {
+        ssize_t n = write ? pwritev(fd, &iov[first], iov.size() - first, offset)
+                          : preadv(fd, &iov[first], iov.size() - first, offset);
+        if (n <= 0) return false;
+        offset += n;
+        while (first < iov.size() && (size_t)n >= iov[first].iov_len) {
+            n -= iov[first].iov_len;
+            first++;
+        }
+        if (first < iov.size()) {
+            iov[first].iov_base = static_cast<uint8_t*>(iov[first].iov_base) + n;
+            iov[first].iov_len -= n;
+        }
+    }
+    return true;
+}
+} // namespace
+
+VirtioBlock::VirtioBlock(Memory& mem, IrqCallback irq, PollRequest request_poll, unsigned io_threads)
+    : mem(mem), irq(std::move(irq)), request_poll(std::move(request_poll)) {
+    for (unsigned i = 0; i < io_threads; ++i) {
+        workers.emplace_back(&VirtioBlock::worker_loop, this);
+    }
+}
+
+VirtioBlock::~VirtioBlock() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_cv.notify_all();
+    for (std::thread& t : workers) t.join();
+    if (fd >= 0) close(fd);
+}
+
+bool VirtioBlock::open(const std::string& path) {
+    fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) return false;
+    capacity = st.st_size / SECTOR_SIZE;
+    return true;
+}
+
+uint32_t VirtioBlock::mmio_read(uint32_t offset, uint32_t size) {
+    (void)size;
+    poll();
+    if (offset >= REG_CONFIG) {
+        // Config space: 64-bit capacity in sectors
+        uint64_t config = capacity;
+        uint32_t at = offset - REG_CONFIG;
+        return at < 8 ? (uint32_t)(config >> (at * 8)) : 0;
+    }
+    uint64_t features = VIRTIO_F_VERSION_1 | VIRTIO_BLK_F_FLUSH;
+    switch (offset) {
+        case REG_MAGIC: return 0x74726976; // "virt"
+        case REG_VERSION: return 2;
+        case REG_DEVICE_ID: return 2;      // Block device
+        case REG_VENDOR_ID: return 0x554D4953;
+        case REG_DEVICE_FEATURES: return device_features_sel < 2 ? (uint32_t)(features >> (32 * device_features_sel)) : 0;
+        case REG_QUEUE_NUM_MAX: return QUEUE_SIZE_MAX;
+        case REG_QUEUE_READY: return queue_ready;
+        case REG_INTERRUPT_STATUS: return interrupt_status;
+        case REG_STATUS: return device_status;
+        case REG_CONFIG_GENERATION: return 0;
+        default: return 0;
+    }
+}
+
+void VirtioBlock::mmio_write(uint32_t offset, uint32_t value, uint32_t size) {
+    (void)size;
+    poll();
+    switch (offset) {
+        case REG_DEVICE_FEATURES_SEL: device_features_sel = value; break;
+        case REG_DRIVER_FEATURES_SEL: driver_features_sel = value; break;
+        case REG_DRIVER_FEATURES:
+            if (driver_features_sel < 2) {
+                uint32_t shift = 32 * driver_features_sel;
+                driver_features = (driver_features & ~(0xFFFFFFFFull << shift)) | ((uint64_t)value << shift);
+            }
+            break;
+        case REG_QUEUE_SEL: break; // Only queue 0 exists
+        case REG_QUEUE_NUM: queue_num = (value && value <= QUEUE_SIZE_MAX) ? value : QUEUE_SIZE_MAX; break;
+        case REG_QUEUE_READY: queue_ready = value & 1; break;
+        case REG_QUEUE_DESC_LOW: desc_addr = value; break;
+        case REG_QUEUE_DRIVER_LOW: avail_addr = value; break;
+        case REG_QUEUE_DEVICE_LOW: used_addr = value; break;
+        case REG_QUEUE_NOTIFY: if (value == 0 && queue_ready) process_queue(); break;
+        case REG_INTERRUPT_ACK:
+            interrupt_status &= ~value;
+            if (!interrupt_status) irq(false);
+            break;
+        case REG_STATUS:
+            if (value == 0) reset_device();
+            else device_status = value;
+            break;
+        default: break; // High address halves and config space are read-only zero
+    }
+}
+
+void VirtioBlock::reset_device() {
+    wait_idle();
+    device_status = 0;
+    driver_features = 0;
+    queue_num = QUEUE_SIZE_MAX;
+    queue_ready = false;
+    desc_addr = avail_addr = used_addr = 0;
+    last_avail = 0;
+    used_idx = 0;
+    {
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        completed.clear();
+    }
+    interrupt_status = 0;
+    irq(false);
+}
+
+// Runs on the CPU thread, from the QueueNotify write
+void VirtioBlock::process_queue() {
+    const uint8_t* avail = mem.dma(avail_addr, 4 + 2 * queue_num, false);
+    if (!avail || !mem.dma(used_addr, 4 + 8 * queue_num, false)) return;
+    uint16_t avail_idx = le16(avail + 2);
+    while (last_avail != avail_idx) {
+        uint16_t head = le16(avail + 4 + 2 * (last_avail % queue_num));
+        last_avail++;
+        Request req;
+        if (!parse_request(head, req)) {
+            // Still complete it, so the driver gets its descriptors back
+            req.type = REQUEST_MALFORMED;
+            req.data.clear();
+        }
+        submit(std::move(req));
+    }
+}
+
+bool VirtioBlock::parse_request(uint16_t head, Request& req) {
+    req.head = head;
+    const uint8_t* table = mem.dma(desc_addr, 16 * queue_num, false);
+    if (!table) return false;
+
+    // Header, then data buffers, then the one-byte status the device writes
+    std::vector<const uint8_t*> chain;
+    uint16_t index = head;
+    for (uint32_t n = 0; n < queue_num; ++n) {
+        if (index >= queue_num) return false;
+        const uint8_t* desc = table + 16 * index;
+        chain.push_back(desc);
+        if (!(le16(desc + 12) & VIRTQ_DESC_F_NEXT)) break;
+        index = le16(desc + 14);
+    }
+    if (chain.size() < 2) return false;
+
+    const uint8_t* last = chain.back();
+    if (le32(last + 8) < 1 || !(le16(last + 12) & VIRTQ_DESC_F_WRITE) || le64(last) >> 32) return false;
+    req.status = mem.dma(le64(last), 1, true);
+
+    const uint8_t* header = mem.dma(le64(chain[0]), 16, false);
+    if (!header || le32(chain[0] + 8) < 16 || le64(chain[0]) >> 32) return false;
+    req.type = le32(header);
+    req.sector = le64(header + 8);
+
+    bool device_writes = req.type == VIRTIO_BLK_T_IN || req.type == VIRTIO_BLK_T_GET_ID;
+    for (size_t i = 1; i + 1 < chain.size(); ++i) {
+        uint64_t addr = le64(chain[i]);
+        uint32_t len = le32(chain[i] + 8);
+        bool writable = le16(chain[i] + 12) & VIRTQ_DESC_F_WRITE;
+        if (writable != device_writes || addr >> 32) return false;
+        uint8_t* host = mem.dma(addr, len, writable);
+        if (!host) return false;
+        req.data.push_back({host, len});
+    }
+    return req.status != nullptr;
+}
+
+void VirtioBlock::submit(Request req) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (in_flight++ == 0) busy_since = std::chrono::steady_clock::now();
+        depth_sum += in_flight;
+        submissions++;
+        if (in_flight > stats.max_queue_depth) stats.max_queue_depth = in_flight;
+        queue.push_back(std::move(req));
+    }
+    queue_cv.notify_one();
+}
+
+void VirtioBlock::worker_loop() {
+    for (;;) {
+        Request req;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) return;
+            req = std::move(queue.front());
+            queue.pop_front();
+        }
+        execute(req);
+    }
+}
+
+void VirtioBlock::execute(Request& req) {
+    uint64_t length = 0;
+    for (const iovec& v : req.data) length += v.iov_len;
+
+    uint8_t status = VIRTIO_BLK_S_OK;
+    uint32_t written = 0; // Bytes the device wrote into guest buffers
+    switch (req.type) {
+        case VIRTIO_BLK_T_IN:
+        case VIRTIO_BLK_T_OUT: {
+            bool in = req.type == VIRTIO_BLK_T_IN;
+            bool fits = length % SECTOR_SIZE == 0 && req.sector <= capacity &&
+                        length / SECTOR_SIZE <= capacity - req.sector;
+            if (!fits || !transfer(fd, req.data, req.sector * SECTOR_SIZE, !in)) {
+                status = VIRTIO_BLK_S_IOERR;
+            } else if (in) {
+                written = length;
+            }
+            break;
+        }
+        case VIRTIO_BLK_T_FLUSH:
+            if (fdatasync(fd) != 0) status = VIRTIO_BLK_S_IOERR;
+            break;
+        case VIRTIO_BLK_T_GET_ID: {
+            static const char id[20] = "simple-cpu-emulator";
+            size_t copied = 0;
+            for (const iovec& v : req.data) {
+                size_t n = std::min(v.iov_len, sizeof(id) - copied);
+                std::memcpy(v.iov_base, id + copied, n);
+                copied += n;
+            }
+            written = copied;
+            break;
+        }
+        case REQUEST_MALFORMED:
+            status = VIRTIO_BLK_S_IOERR;
+            break;
+        default:
+            status = VIRTIO_BLK_S_UNSUPP;
+            break;
+    }
+    if (req.status) *req.status = status;
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (status != VIRTIO_BLK_S_OK) stats.errors++;
+        else if (req.type == VIRTIO_BLK_T_IN) { stats.reads++; stats.bytes_read += length; }
+        else if (req.type == VIRTIO_BLK_T_OUT) { stats.writes++; stats.bytes_written += length; }
+        else if (req.type == VIRTIO_BLK_T_FLUSH) stats.flushes++;
+    }
+    complete(req, req.status ? written + 1 : 0);
+}
+
+// Runs on an I/O thread, after the request's buffers and status are written
+void VirtioBlock::complete(const Request& req, uint32_t written) {
+    {
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        completed.push_back({req.head, written});
+    }
+    if (request_poll) request_poll();
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (--in_flight == 0) {
+            stats.busy_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - busy_since).count();
+            idle_cv.notify_all();
+        }
+    }
+}
+
+// Runs on the CPU thread. Taking completion_mutex acquires everything the I/O
+// threads wrote before handing the requests over; the interrupt follows the
+// used index.
+void VirtioBlock::poll() {
+    std::vector<Completion> done;
+    {
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        if (completed.empty()) return;
+        done.swap(completed);
+    }
+    uint8_t* used = mem.dma(used_addr, 4 + 8 * queue_num, true);
+    if (!used) return;
+    for (const Completion& c : done) {
+        uint8_t* elem = used + 4 + 8 * (used_idx % queue_num);
+        put32(elem, c.head);
+        put32(elem + 4, c.written);
+        used_idx++;
+    }
+    put16(used + 2, used_idx);
+    interrupt_status |= 1; // Used buffer notification
+    irq(true);
+}
+
+void VirtioBlock::wait_idle() {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    idle_cv.wait(lock, [this] { return in_flight == 0; });
+}
+
+VirtioBlock::Stats VirtioBlock::get_stats() const {
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    Stats s = stats;
+    s.avg_queue_depth = submissions ? (double)depth_sum / submissions : 0;
+    return s;
+}
@@ -2,40 +2,312 @@
 #include <fstream>
 #include <vector>
 #include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <memory>
 #include "CPU.hpp"
 #include "Memory.hpp"
+#include "GdbStub.hpp"
+#include "VirtioBlock.hpp"
+#include "Energy.hpp"
+#include "Metrics.hpp"
+#include "Checkpoint.hpp"
+#include "MemTrace.hpp"
+#include "CommandLine.hpp"
 
-void print_summary(const CPU& cpu) {
-    uint32_t cycles = cpu.get_csr(CPU::CSR_MCYCLE);
-    uint32_t instret = cpu.get_csr(CPU::CSR_MINSTRET);
+struct Options {
+    std::string filename;
+    std::string gdb_address;
+    std::string block_image;
+    EnergyTable energy_table;
+    std::string metrics_sink;
+    uint64_t metrics_interval = 1000000; // Cycles between publications
+    uint64_t metrics_period_ms = 1000;   // Export period
+    std::string checkpoint_dir;
+    uint64_t checkpoint_interval = 100000000; // Cycles between checkpoints
+    bool resume = false;
+    std::string mem_trace_path;
+    std::string config = DefaultConfig::name;
+    uint64_t max_cycles = 100000;
+};
+
+template <typename Config>
+void print_summary(const BasicCPU<Config>& cpu, double host_seconds, const EnergyTable& energy_table) {
+    uint64_t cycles = cpu.get_cycles();
+    uint64_t instret = cpu.get_instret();
     double ipc = (cycles > 0) ? (double)instret / cycles : 0;
+    double mips = (host_seconds > 0) ? instret / host_seconds / 1e6 : 0;
 
-    uint32_t cache_hits = cpu.get_cache_hits();
-    uint32_t cache_misses = cpu.get_cache_misses();
-    uint32_t total_accesses = cache_hits + cache_misses;
+    uint64_t cache_hits = cpu.get_cache_hits();
+    uint64_t cache_misses = cpu.get_cache_misses();
+    uint64_t total_accesses = cache_hits + cache_misses;
     double hit_rate = (total_accesses > 0) ? (double)cache_hits / total_accesses * 100.0 : 0;
 
-    std::cout << "\n--- Execution Summary ---" << std::endl;
+    std::cout << std::dec << "\n--- Execution Summary ---" << std::endl;
     std::cout << "Total Cycles:      " << cycles << std::endl;
     std::cout << "Instructions:      " << instret << std::endl;
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "IPC:               " << ipc << std::endl;
+    if constexpr (Config::energy) {
+        EnergyReport energy = estimate_energy(cpu.get_energy_counters(), energy_table);
+        std::cout << "Energy:            " << energy.total / 1e3 << " nJ" << std::endl;
+        std::cout << "  Per Stage:       ";
+        for (int i = 0; i < EnergyReport::STAGES; ++i) {
+            std::cout << EnergyReport::stage_names[i] << " " << energy.stage[i] / 1e3 << (i + 1 < EnergyReport::STAGES ? ", " : " nJ\n");
+        }
+        std::cout << "  Control/Leakage: " << energy.control / 1e3 << " / " << energy.leakage / 1e3 << " nJ" << std::endl;
+        std::cout << "Average Power:     " << energy.power_mw << " mW @ " << energy_table.clock_mhz << " MHz" << std::endl;
+        std::cout << "Energy/Instr:      " << energy.per_instruction << " pJ" << std::endl;
+    } else {
+        (void)energy_table;
+    }
     std::cout << "Cache Hits:        " << cache_hits << std::endl;
     std::cout << "Cache Misses:      " << cache_misses << std::endl;
     std::cout << "Cache Hit Rate:    " << hit_rate << "%" << std::endl;
+    LsuStats lsu = cpu.get_lsu_stats();
+    if constexpr (Config::store_buffer_entries > 0 || Config::dcache_miss_cycles > 0) {
+        std::cout << "Miss Stall Cycles: " << lsu.miss_cycles << std::endl;
+        std::cout << "Forwarded Loads:   " << lsu.forwarded_loads << std::endl;
+        std::cout << "Store Stalls:      " << lsu.full_stall_cycles << " full, " << lsu.drain_stall_cycles << " drain, "
+                  << lsu.fence_cycles << " fence cycles" << std::endl;
+    }
+    if (lsu.split_accesses > 0) {
+        std::cout << "Split Accesses:    " << lsu.split_accesses << std::endl;
+    }
+    uint64_t itlb_accesses = cpu.get_itlb_hits() + cpu.get_itlb_misses();
+    uint64_t dtlb_accesses = cpu.get_dtlb_hits() + cpu.get_dtlb_misses();
+    if (itlb_accesses + dtlb_accesses > 0) { // Only once the guest enabled Sv32
+        std::cout << "ITLB Hit Rate:     " << (itlb_accesses ? cpu.get_itlb_hits() * 100.0 / itlb_accesses : 0) << "%" << std::endl;
+        std::cout << "DTLB Hit Rate:     " << (dtlb_accesses ? cpu.get_dtlb_hits() * 100.0 / dtlb_accesses : 0) << "%" << std::endl;
+        std::cout << "Page Walk Cycles:  " << cpu.get_walk_cycles() << std::endl;
+    }
+    std::cout << "Host Time:         " << host_seconds * 1000.0 << " ms" << std::endl;
+    std::cout << "Guest MIPS:        " << mips << std::endl;
+    std::cout << "-------------------------" << std::endl;
+}
+
+void print_block_summary(const VirtioBlock& block) {
+    VirtioBlock::Stats stats = block.get_stats();
+    double mb = (stats.bytes_read + stats.bytes_written) / 1e6;
+    std::cout << std::dec << std::fixed << std::setprecision(2);
+    std::cout << "--- Block Device ---" << std::endl;
+    std::cout << "Reads/Writes:      " << stats.reads << " / " << stats.writes << std::endl;
+    std::cout << "Flushes/Errors:    " << stats.flushes << " / " << stats.errors << std::endl;
+    std::cout << "Bytes Read:        " << stats.bytes_read << std::endl;
+    std::cout << "Bytes Written:     " << stats.bytes_written << std::endl;
+    std::cout << "Throughput:        " << (stats.busy_seconds > 0 ? mb / stats.busy_seconds : 0) << " MB/s" << std::endl;
+    std::cout << "Queue Depth:       " << stats.avg_queue_depth << " avg, " << stats.max_queue_depth << " max" << std::endl;
     std::cout << "-------------------------" << std::endl;
 }
 
+// Runs up to max_cycles total (a resumed run counts its restored cycles) in
+// chunks, publishing metrics every metrics_interval cycles and checkpointing
+// every checkpoint_interval. run() resumes exactly where the previous chunk
+// stopped; only the drain before each checkpoint perturbs timing.
+template <typename Config>
+StopReason run_chunked(BasicCPU<Config>& cpu, const Options& opts, MetricsPublisher* publisher,
+                       Checkpointer* checkpointer, std::chrono::steady_clock::time_point start) {
+    const uint64_t never = UINT64_MAX;
+    uint64_t next_publish = publisher ? cpu.get_cycles() + opts.metrics_interval : never;
+    uint64_t next_checkpoint = checkpointer ? cpu.get_cycles() + opts.checkpoint_interval : never;
+    StopReason reason = StopReason::CycleLimit;
+    while (reason == StopReason::CycleLimit && cpu.get_cycles() < opts.max_cycles) {
+        uint64_t target = std::min({opts.max_cycles, next_publish, next_checkpoint});
+        reason = cpu.run(target - cpu.get_cycles());
+        if (publisher && (cpu.get_cycles() >= next_publish || reason != StopReason::CycleLimit)) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            publisher->publish({cpu.get_cycles(), cpu.get_instret(), cpu.get_cache_hits(), cpu.get_cache_misses(), elapsed.count()});
+            next_publish = cpu.get_cycles() + opts.metrics_interval;
+        }
+        if (checkpointer && cpu.get_cycles() >= next_checkpoint && reason == StopReason::CycleLimit) {
+            cpu.drain();
+            cpu.resume();
+            StateWriter state;
+            cpu.save_state(state);
+            checkpointer->capture(std::move(state.data));
+            next_checkpoint = cpu.get_cycles() + opts.checkpoint_interval;
+        }
+    }
+    return reason;
+}
+
+template <typename Config>
+int run_program(const Options& opts, Memory& mem, uint32_t program_size) {
+    BasicCPU<Config> cpu(mem);
+
+    std::unique_ptr<VirtioBlock> block;
+    if (!opts.block_image.empty()) {
+        block = std::make_unique<VirtioBlock>(mem, [&cpu](bool level) { cpu.set_irq(cpu.MIP_MEIP, level); },
+                                              [&cpu] { cpu.request_device_poll(); });
+        cpu.set_device_poll([&block] { block->poll(); });
+        if (!block->open(opts.block_image)) {
+            std::cerr << "Error: Could not open block image " << opts.block_image << std::endl;
+            return 1;
+        }
+        mem.map_mmio(VirtioBlock::DEFAULT_BASE, VirtioBlock::MMIO_SIZE,
+            [&block](uint32_t offset, uint32_t size) { return block->mmio_read(offset, size); },
+            [&block](uint32_t offset, uint32_t value, uint32_t size) { block->mmio_write(offset, value, size); });
+    }
+
+    if (!opts.gdb_address.empty()) {
+        GdbStub<Config> stub(cpu, mem);
+        if (!stub.listen(opts.gdb_address)) return 1;
+        stub.serve();
+        if (stub.killed()) return 0;
+    }
+
+    std::cout << "Starting execution of " << opts.filename << "..." << std::endl;
+
+    // Run the pipeline until the guest halts, or until fetch runs off the
+    // end of the program (+16 to allow the pipeline to drain)
+    cpu.set_fetch_limit(program_size + 16);
+
+    std::unique_ptr<Checkpointer> checkpointer;
+    if (!opts.checkpoint_dir.empty()) {
+        checkpointer = std::make_unique<Checkpointer>(mem, opts.checkpoint_dir, Config::name);
+        if (opts.resume) {
+            std::vector<uint8_t> state;
+            uint32_t sequence;
+            std::string error;
+            if (!Checkpointer::resume(opts.checkpoint_dir, Config::name, mem, state, sequence, error)) {
+                std::cerr << "Error: Could not resume: " << error << std::endl;
+                return 1;
+            }
+            StateReader in(state.data(), state.size());
+            if (!cpu.load_state(in)) {
+                std::cerr << "Error: Could not resume: corrupt CPU state" << std::endl;
+                return 1;
+            }
+            checkpointer->set_sequence(sequence);
+            std::cout << "Resumed from checkpoint " << sequence << " at cycle " << cpu.get_cycles() << std::endl;
+        }
+        if (!checkpointer->open()) return 1;
+    }
+
+    MemTraceWriter mem_trace;
+    if (!opts.mem_trace_path.empty()) {
+        if constexpr (Config::mem_trace) {
+            if (!mem_trace.open(opts.mem_trace_path)) {
+                std::cerr << "Error: Could not create memory trace " << opts.mem_trace_path << std::endl;
+                return 1;
+            }
+            cpu.set_mem_trace(&mem_trace);
+        } else {
+            std::cerr << "Error: --mem-trace needs --config " << MemTraceConfig::name << std::endl;
+            return 1;
+        }
+    }
+
+    MetricsPublisher publisher;
+    std::unique_ptr<MetricsSampler> sampler;
+    if (!opts.metrics_sink.empty()) {
+        sampler = std::make_unique<MetricsSampler>(publisher, std::chrono::milliseconds(opts.metrics_period_ms));
+        if (!sampler->open(opts.metrics_sink)) return 1;
+        sampler->start();
+    }
+    auto start = std::chrono::steady_clock::now();
+    StopReason reason = (sampler || checkpointer)
+        ? run_chunked(cpu, opts, sampler ? &publisher : nullptr, checkpointer.get(), start)
+        : cpu.run(opts.max_cycles);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (sampler) sampler->stop();
+    if (checkpointer) checkpointer->flush();
+    if (reason == StopReason::Halted) {
+        std::cout << "Halt signal received." << std::endl;
+    }
+
+    std::cout << "Execution finished." << std::endl;
+    cpu.dump_registers();
+    print_summary(cpu, elapsed.count(), opts.energy_table);
+    if (block) {
+        block->wait_idle();
+        print_block_summary(*block);
+    }
+    if (checkpointer) {
+        std::cout << "Checkpoints:       " << checkpointer->get_count() << " (" << checkpointer->get_bytes_written() / 1024
+                  << " KiB, " << checkpointer->get_capture_seconds() * 1000.0 << " ms capturing)" << std::endl;
+    }
+    if (!opts.mem_trace_path.empty()) {
+        uint64_t count = mem_trace.get_count();
+        uint64_t bytes = mem_trace.get_bytes();
+        if (!mem_trace.close()) {
+            std::cerr << "Error: Could not write memory trace " << opts.mem_trace_path << std::endl;
+            return 1;
+        }
+        std::cout << "Memory Trace:      " << count << " accesses (" << bytes / 1024 << " KiB, "
+                  << (count ? (double)bytes / count : 0) << " bytes/access)" << std::endl;
+    }
+
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <binary_file>" << std::endl;
+    Options opts;
+    bool usage_error = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--gdb" && i + 1 < argc) {
+            opts.gdb_address = argv[++i];
+        } else if (arg == "--max-cycles" && i + 1 < argc) {
+            if (!parse_number(argv[++i], opts.max_cycles)) usage_error = true;
+        } else if (arg == "--block" && i + 1 < argc) {
+            opts.block_image = argv[++i];
+        } else if (arg == "--energy-table" && i + 1 < argc) {
+            std::string error;
+            if (!load_energy_table(argv[++i], opts.energy_table, error)) {
+                std::cerr << "Error: " << error << std::endl;
+                return 1;
+            }
+        } else if (arg == "--metrics" && i + 1 < argc) {
+            opts.metrics_sink = argv[++i];
+        } else if (arg == "--metrics-interval" && i + 1 < argc) {
+            if (!parse_number(argv[++i], opts.metrics_interval)) usage_error = true;
+            opts.metrics_interval = std::max<uint64_t>(1, opts.metrics_interval);
+        } else if (arg == "--metrics-period" && i + 1 < argc) {
+            if (!parse_number(argv[++i], opts.metrics_period_ms)) usage_error = true;
+            opts.metrics_period_ms = std::max<uint64_t>(1, opts.metrics_period_ms);
+        } else if (arg == "--checkpoint" && i + 1 < argc) {
+            opts.checkpoint_dir = argv[++i];
+        } else if (arg == "--checkpoint-interval" && i + 1 < argc) {
+            if (!parse_number(argv[++i], opts.checkpoint_interval)) usage_error = true;
+            opts.checkpoint_interval = std::max<uint64_t>(1, opts.checkpoint_interval);
+        } else if (arg == "--mem-trace" && i + 1 < argc) {
+            opts.mem_trace_path = argv[++i];
+        } else if (arg == "--resume") {
+            opts.resume = true;
+        } else if (arg == "--config" && i + 1 < argc) {
+            opts.config = argv[++i];
+        } else if (opts.filename.empty() && arg.rfind("--", 0) != 0) {
+            opts.filename = arg;
+        } else {
+            usage_error = true;
+            break;
+        }
+    }
+    if (opts.resume && opts.checkpoint_dir.empty()) {
+        usage_error = true;
+    }
+    if (!opts.checkpoint_dir.empty() && !opts.block_image.empty()) {
+        std::cerr << "Error: --checkpoint does not support --block (device state is not checkpointed)" << std::endl;
+        return 1;
+    }
+    if (usage_error || opts.filename.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--gdb <port|host:port|unix:path>] [--max-cycles N]"
+                  << " [--block <image>] [--energy-table <file>]"
+                  << " [--metrics <csv:file|json:file|unix:path>] [--metrics-interval N] [--metrics-period ms]"
+                  << " [--checkpoint <dir>] [--checkpoint-interval N] [--resume] [--mem-trace <file>]"
+                  << " [--config <name>] <binary_file>" << std::endl;
+        std::cerr << "Configurations:";
+#define LIST_CONFIG(Config) std::cerr << " " << Config::name;
+        FOR_EACH_CORE_CONFIG(LIST_CONFIG)
+#undef LIST_CONFIG
+        std::cerr << std::endl;
         return 1;
     }
 
-    std::string filename = argv[1];
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    std::ifstream file(opts.filename, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
-        std::cerr << "Error: Could not open file " << filename << std::endl;
+        std::cerr << "Error: Could not open file " << opts.filename << std::endl;
         return 1;
     }
 
@@ -44,42 +316,18 @@ int main(int argc, char* argv[]) {
 
     std::vector<uint32_t> program(size / 4);
     if (!file.read(reinterpret_cast<char*>(program.data()), size)) {
-        std::cerr << "Error: Could not read file " << filename << std::endl;
+        std::cerr << "Error: Could not read file " << opts.filename << std::endl;
         return 1;
     }
 
     Memory mem(1024 * 1024); // 1MB Memory
     mem.load_program(program);
 
-    CPU cpu(mem);
-
-    std::cout << "Starting execution of " << filename << "..." << std::endl;
-
-    // Run the pipeline
-    // For now, we'll run for a max number of cycles or until an error
-    // In a real system, we'd wait for a 'halt' signal or ecall
-    const uint32_t MAX_CYCLES = 100000;
-    uint32_t current_cycle = 0;
-
-    while (current_cycle < MAX_CYCLES) {
-        cpu.clock();
-        current_cycle++;
+#define RUN_IF_SELECTED(Config) \
+    if (opts.config == Config::name) return run_program<Config>(opts, mem, size);
+    FOR_EACH_CORE_CONFIG(RUN_IF_SELECTED)
+#undef RUN_IF_SELECTED
 
-        if (cpu.is_halted()) {
-            std::cout << "Halt signal received." << std::endl;
-            break;
-        }
-
-        // Basic exit condition: if we hit a sequence of 0s (uninitialized memory)
-        // or a very high address. This is a simplification.
-        if (cpu.fetch_pc() >= size + 16) { // +16 to allow pipeline to drain
-            break;
-        }
-    }
-
-    std::cout << "Execution finished." << std::endl;
-    cpu.dump_registers();
-    print_summary(cpu);
-
-    return 0;
+    std::cerr << "Error: Unknown configuration " << opts.config << std::endl;
+    return 1;
 }
@@ -0,0 +1,143 @@
+#ifndef RANDOM_PROGRAM_HPP
+#define RANDOM_PROGRAM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Random RV32I program generator for co-simulation. Control flow only moves
+// forward, so every program terminates at its final ECALL. Register use:
+//   x29 - base of the data window (never overwritten)
+//   x30 - scratch for AUIPC/JALR pairs (never a random destination)
+struct RandomProgram {
+    static constexpr uint32_t DATA_BASE = 0x10000;
+    static constexpr uint32_t DATA_SIZE = 2048;
+
+    std::vector<uint32_t> code; // Loaded at address 0
+    std::vector<uint32_t> data; // Loaded at DATA_BASE
+
+    static RandomProgram generate(std::mt19937& rng, uint32_t length) {
+        RandomProgram p;
+        Generator g{rng};
+
+        for (uint32_t i = 0; i < DATA_SIZE / 4; ++i) p.data.push_back(rng());
+
+        // Prologue: data base and random register contents
+        p.code.push_back(lui(29, DATA_BASE));
+        for (uint32_t r = 1; r <= 28; ++r) {
+            uint32_t v = rng();
+            p.code.push_back(lui(r, v + ((v & 0x800) << 1)));
+            p.code.push_back(i_type(0x13, 0, r, r, v & 0xFFF));
+        }
+
+        // Body as blocks, so branches never land between an AUIPC and its JALR
+        std::vector<std::vector<uint32_t>> blocks(length);
+        std::vector<int> jump_span(length, 0); // Blocks to skip, 0 if not control flow
+        for (uint32_t b = 0; b < length; ++b) {
+            uint32_t kind = g.pick(100);
+            if (kind < 10) {
+                jump_span[b] = 1 + g.pick(6); // Branch
+            } else if (kind < 13) {
+                jump_span[b] = -1 - (int)g.pick(6); // JAL (negative marks the kind)
+            } else if (kind < 16) {
+                jump_span[b] = 100 + g.pick(4); // AUIPC+JALR skipping 0-3 words
+            } else {
+                blocks[b].push_back(g.straight_line());
+            }
+        }
+
+        // Lay out blocks to learn their addresses, then fill in control flow
+        std::vector<uint32_t> addr(length + 1);
+        uint32_t pc = p.code.size() * 4;
+        for (uint32_t b = 0; b < length; ++b) {
+            addr[b] = pc;
+            pc += (jump_span[b] >= 100 ? 2 + (jump_span[b] - 100) : 1) * 4;
+        }
+        addr[length] = pc; // The final ECALL
+
+        for (uint32_t b = 0; b < length; ++b) {
+            int span = jump_span[b];
+            if (span >= 100) {
+                uint32_t skip = span - 100;
+                blocks[b].push_back(u_type(0x17, 30, 0));                          // auipc x30, 0
+                blocks[b].push_back(i_type(0x67, 0, g.dest(), 30, 8 + skip * 4)); // jalr rd, x30
+                for (uint32_t i = 0; i < skip; ++i) blocks[b].push_back(g.straight_line());
+            } else if (span != 0) {
+                uint32_t target = addr[std::min<uint32_t>(b + std::abs(span), length)];
+                int32_t offset = target - addr[b];
+                blocks[b].push_back(span > 0 ? g.branch(offset) : jal(g.dest(), offset));
+            }
+        }
+        for (const auto& block : blocks) p.code.insert(p.code.end(), block.begin(), block.end());
+        p.code.push_back(0x00000073); // ecall
+        return p;
+    }
+
+    static uint32_t i_type(uint32_t op, uint32_t f3, uint32_t rd, uint32_t rs1, uint32_t imm) {
+        return (imm << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op;
+    }
+    static uint32_t r_type(uint32_t f7, uint32_t f3, uint32_t rd, uint32_t rs1, uint32_t rs2) {
+        return (f7 << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | 0x33;
+    }
+    static uint32_t s_type(uint32_t f3, uint32_t rs1, uint32_t rs2, uint32_t imm) {
+        return ((imm >> 5) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | ((imm & 0x1F) << 7) | 0x23;
+    }
+    static uint32_t u_type(uint32_t op, uint32_t rd, uint32_t imm) { return (imm & 0xFFFFF000) | (rd << 7) | op; }
+    static uint32_t lui(uint32_t rd, uint32_t imm) { return u_type(0x37, rd, imm); }
+    static uint32_t jal(uint32_t rd, int32_t off) {
+        uint32_t o = off;
+        return (((o >> 20) & 1) << 31) | (((o >> 1) & 0x3FF) << 21) | (((o >> 11) & 1) << 20) |
+               (((o >> 12) & 0xFF) << 12) | (rd << 7) | 0x6F;
+    }
+
+private:
+    struct Generator {
+        std::mt19937& rng;
+
+        uint32_t pick(uint32_t n) { return rng() % n; }
+        // Mostly x1-x28, sometimes x0 to check that writes to it are dropped
+        uint32_t dest() { return pick(16) == 0 ? 0 : 1 + pick(28); }
+        uint32_t src() { return pick(30); }
+
+        uint32_t straight_line() {
+            static const uint32_t LOAD_F3[5] = {0, 1, 2, 4, 5};
+            switch (pick(6)) {
+                case 0: { // OP
+                    uint32_t f3 = pick(8);
+                    uint32_t f7 = (f3 == 0 || f3 == 5) && pick(2) ? 0x20 : 0;
+                    return r_type(f7, f3, dest(), src(), src());
+                }
+                case 1: case 2: { // OP-IMM
+                    uint32_t f3 = pick(8);
+                    uint32_t imm = rng() & 0xFFF;
+                    if (f3 == 1) imm &= 0x1F;
+                    if (f3 == 5) imm = (imm & 0x1F) | (pick(2) ? 0x400 : 0);
+                    return i_type(0x13, f3, dest(), src(), imm);
+                }
+                case 3: // LUI/AUIPC
+                    return u_type(pick(2) ? 0x37 : 0x17, dest(), rng());
+                case 4: { // Naturally aligned load from the data window
+                    uint32_t f3 = LOAD_F3[pick(5)];
+                    uint32_t size = 1 << (f3 & 3);
+                    return i_type(0x03, f3, dest(), 29, pick(DATA_SIZE / size) * size);
+                }
+                default: { // Naturally aligned store to the data window
+                    uint32_t f3 = pick(3);
+                    uint32_t size = 1 << f3;
+                    return s_type(f3, 29, src(), pick(DATA_SIZE / size) * size);
+                }
+            }
+        }
+
+        uint32_t branch(int32_t off) {
+            static const uint32_t F3[6] = {0, 1, 4, 5, 6, 7};
+            uint32_t o = off;
+            return (((o >> 12) & 1) << 31) | (((o >> 5) & 0x3F) << 25) | (src() << 20) | (src() << 15) |
+                   (F3[pick(6)] << 12) | (((o >> 1) & 0xF) << 8) | (((o >> 11) & 1) << 7) | 0x63;
+        }
+    };
+};
+
+#endif // RANDOM_PROGRAM_HPP
@@ -0,0 +1,163 @@
+#ifndef REF_MODEL_HPP
+#define REF_MODEL_HPP
+
+#include "CPU.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Golden RV32I model for co-simulation: a plain one-instruction-at-a-time
+// interpreter with no pipeline, caches or forwarding to get wrong.
+class RefModel {
+public:
+    explicit RefModel(uint32_t mem_size) : mem(mem_size, 0) {}
+
+    std::vector<uint8_t> mem;
+    uint32_t regs[32] = {};
+    uint32_t pc = 0;
+    bool halted = false;
+
+    void load(const std::vector<uint32_t>& words, uint32_t base) {
+        for (size_t i = 0; i < words.size(); ++i) store(base + i * 4, words[i], 4);
+    }
+
+    uint32_t load_value(uint32_t addr, int size) const {
+        uint32_t v = 0;
+        for (int i = 0; i < size; ++i) v |= (uint32_t)mem[addr + i] << (i * 8);
+        return v;
+    }
+
+    void store(uint32_t addr, uint32_t value, int size) {
+        for (int i = 0; i < size; ++i) mem[addr + i] = (value >> (i * 8)) & 0xFF;
+    }
+
+    // Executes one instruction and reports its effects in RetireInfo form
+    RetireInfo step() {
+        RetireInfo info;
+        uint32_t instr = load_value(pc, 4);
+        info.pc = pc;
+        info.instruction = instr;
+
+        uint32_t opcode = instr & 0x7F;
+        uint32_t rd = (instr >> 7) & 0x1F;
+        uint32_t f3 = (instr >> 12) & 0x7;
+        uint32_t f7 = instr >> 25;
+        uint32_t a = regs[(instr >> 15) & 0x1F];
+        uint32_t b = regs[(instr >> 20) & 0x1F];
+        int32_t imm_i = (int32_t)instr >> 20;
+        int32_t imm_s = ((int32_t)instr >> 25 << 5) | ((instr >> 7) & 0x1F);
+        int32_t imm_b = ((int32_t)instr >> 31 << 12) | (((instr >> 7) & 1) << 11) |
+                        (((instr >> 25) & 0x3F) << 5) | (((instr >> 8) & 0xF) << 1);
+        int32_t imm_j = ((int32_t)instr >> 31 << 20) | (instr & 0xFF000) |
+                        (((instr >> 20) & 1) << 11) | (((instr >> 21) & 0x3FF) << 1);
+
+        uint32_t next_pc = pc + 4;
+        bool writes = false;
+        uint32_t result = 0;
+
+        switch (opcode) {
+            case 0x37: writes = true; result = instr & 0xFFFFF000; break;
+            case 0x17: writes = true; result = pc + (instr & 0xFFFFF000); break;
+            case 0x6F: writes = true; result = pc + 4; next_pc = pc + imm_j; break;
+            case 0x67: writes = true; result = pc + 4; next_pc = (a + imm_i) & ~1u; break;
+            case 0x63: {
+                bool take = false;
+                switch (f3) {
+                    case 0: take = a == b; break;
+                    case 1: take = a != b; break;
+                    case 4: take = (int32_t)a < (int32_t)b; break;
+                    case 5: take = (int32_t)a >= (int32_t)b; break;
+                    case 6: take = a < b; break;
+                    case 7: take = a >= b; break;
+                }
+                if (take) next_pc = pc + imm_b;
+                break;
+            }
+            case 0x03: {
+                uint32_t addr = a + imm_i;
+                writes = true;
+                switch (f3) {
+                    case 0: result = (int32_t)(int8_t)load_value(addr, 1); break;
+                    case 1: result = (int32_t)(int16_t)load_value(addr, 2); break;
+                    case 2: result = load_value(addr, 4); break;
+                    case 4: result = load_value(addr, 1); break;
+                    case 5: result = load_value(addr, 2); break;
+                }
+                break;
+            }
+            case 0x23: {
+                int size = 1 << (f3 & 3);
+                info.store_size = size;
+                info.store_addr = a + imm_s;
+                info.store_value = size == 4 ? b : b & ((1u << (size * 8)) - 1);
+                store(info.store_addr, info.store_value, size);
+                break;
+            }
+            case 0x13: case 0x33: {
+                bool reg = opcode == 0x33;
+                uint32_t op2 = reg ? b : (uint32_t)imm_i;
+                uint32_t sh = op2 & 0x1F;
+                writes = true;
+                switch (f3) {
+                    case 0: result = (reg && f7 == 0x20) ? a - op2 : a + op2; break;
+                    case 1: result = a << sh; break;
+                    case 2: result = (int32_t)a < (int32_t)op2; break;
+                    case 3: result = a < op2; break;
+                    case 4: result = a ^ op2; break;
+                    case 5: result = (f7 == 0x20) ? (uint32_t)((int32_t)a >> sh) : a >> sh; break;
+                    case 6: result = a | op2; break;
+                    case 7: result = a & op2; break;
+                }
+                break;
+            }
+            case 0x73:
+                if (instr == 0x00000073) halted = true; // ECALL ends the program
+                break;
+        }
+
+        if (writes && rd != 0) {
+            regs[rd] = result;
+            info.rd = rd;
+            info.rd_value = result;
+        }
+        pc = next_pc;
+        return info;
+    }
+};
+
+// Short mnemonic for divergence reports
+inline std::string disassemble(uint32_t instr) {
+    static const char* const ALU[8] = {"add", "sll", "slt", "sltu", "xor", "srl", "or", "and"};
+    static const char* const ALU_IMM[8] = {"addi", "slli", "slti", "sltiu", "xori", "srli", "ori", "andi"};
+    static const char* const BRANCH[8] = {"beq", "bne", "?", "?", "blt", "bge", "bltu", "bgeu"};
+    static const char* const LOAD[8] = {"lb", "lh", "lw", "?", "lbu", "lhu", "?", "?"};
+    static const char* const STORE[4] = {"sb", "sh", "sw", "?"};
+    uint32_t f3 = (instr >> 12) & 0x7;
+    bool alt = (instr >> 30) & 1;
+    char buf[64];
+    int rd = (instr >> 7) & 0x1F, rs1 = (instr >> 15) & 0x1F, rs2 = (instr >> 20) & 0x1F;
+    int32_t imm_i = (int32_t)instr >> 20;
+    switch (instr & 0x7F) {
+        case 0x37: std::snprintf(buf, sizeof(buf), "lui x%d, 0x%x", rd, instr >> 12); break;
+        case 0x17: std::snprintf(buf, sizeof(buf), "auipc x%d, 0x%x", rd, instr >> 12); break;
+        case 0x6F: std::snprintf(buf, sizeof(buf), "jal x%d", rd); break;
+        case 0x67: std::snprintf(buf, sizeof(buf), "jalr x%d, %d(x%d)", rd, imm_i, rs1); break;
+        case 0x63: std::snprintf(buf, sizeof(buf), "%s x%d, x%d", BRANCH[f3], rs1, rs2); break;
+        case 0x03: std::snprintf(buf, sizeof(buf), "%s x%d, %d(x%d)", LOAD[f3], rd, imm_i, rs1); break;
+        case 0x23: std::snprintf(buf, sizeof(buf), "%s x%d, (x%d)", STORE[f3 & 3], rs2, rs1); break;
+        case 0x13:
+            std::snprintf(buf, sizeof(buf), "%s x%d, x%d, %d", (f3 == 5 && alt) ? "srai" : ALU_IMM[f3],
+                          rd, rs1, (f3 == 1 || f3 == 5) ? rs2 : imm_i);
+            break;
+        case 0x33:
+            std::snprintf(buf, sizeof(buf), "%s x%d, x%d, x%d",
+                          alt ? (f3 == 0 ? "sub" : "sra") : ALU[f3], rd, rs1, rs2);
+            break;
+        case 0x73: std::snprintf(buf, sizeof(buf), instr == 0x73 ? "ecall" : "system"); break;
+        default: std::snprintf(buf, sizeof(buf), "unknown");
+    }
+    return buf;
+}
+
+#endif // REF_MODEL_HPP
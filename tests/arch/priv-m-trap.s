@@ -0,0 +1,78 @@
+# Machine-mode CSR access, ECALL/EBREAK/illegal-instruction traps and MRET
+# Signature words are checked against priv-m-trap.reference_output.
+    .section .text.init
+    .globl rvtest_entry_point
+rvtest_entry_point:
+    la x31, begin_signature
+    la x1, trap_handler
+    csrw mtvec, x1
+    li x1, 305419896
+    csrrw x2, mscratch, x1
+    csrr x3, mscratch
+    sw x2, 0(x31)
+    sw x3, 4(x31)
+    li x1, 65280
+    csrrs x2, mscratch, x1
+    csrr x3, mscratch
+    sw x2, 8(x31)
+    sw x3, 12(x31)
+    li x1, 301989888
+    csrrc x2, mscratch, x1
+    csrr x3, mscratch
+    sw x2, 16(x31)
+    sw x3, 20(x31)
+    csrrwi x2, mscratch, 21
+    csrrsi x3, mscratch, 10
+    csrrci x4, mscratch, 1
+    csrr x5, mscratch
+    sw x2, 24(x31)
+    sw x3, 28(x31)
+    sw x4, 32(x31)
+    sw x5, 36(x31)
+    li x29, 0
+    addi x28, x31, 40
+    la x30, 6f
+6:
+    ecall
+    la x30, 6f
+6:
+    ebreak
+    la x30, 6f
+6:
+    csrw cycle, x0
+    la x30, 6f
+6:
+    csrrs x0, cycle, x1
+    j 7f
+    .align 2
+trap_handler:
+    csrr x25, mcause
+    sw x25, 0(x28)
+    csrr x26, mepc
+    sub x27, x26, x30
+    sw x27, 4(x28)
+    csrr x24, mtval
+    li x23, 3
+    bne x25, x23, 8f
+    sub x24, x24, x30 # EBREAK reports its pc
+8:
+    sw x24, 8(x28)
+    addi x28, x28, 12
+    addi x26, x26, 4
+    csrw mepc, x26
+    mret
+7:
+    csrr x3, mcause
+    sw x3, 88(x31)
+
+    # Halt: M-mode ECALL with mtvec clear
+    csrw mtvec, x0
+    ecall
+
+    .data
+    .align 4
+    .globl begin_signature
+begin_signature:
+    .fill 23, 4, 0xdeadbeef
+    .globl end_signature
+end_signature:
@@ -0,0 +1,4669 @@
+# Register-register and register-immediate arithmetic, logic, compares and shifts
+# Signature words are checked against rv32i-alu.reference_output.
+    .section .text.init
+    .globl rvtest_entry_point
+rvtest_entry_point:
+    la x31, begin_signature
+    # add
+    li x1, 0
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 0(x31)
+    li x1, 0
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 4(x31)
+    li x1, 0
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 8(x31)
+    li x1, 0
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 12(x31)
+    li x1, 0
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 16(x31)
+    li x1, 0
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 20(x31)
+    li x1, 0
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 24(x31)
+    li x1, 0
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 28(x31)
+    li x1, 0
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 32(x31)
+    li x1, 1
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 36(x31)
+    li x1, 1
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 40(x31)
+    li x1, 1
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 44(x31)
+    li x1, 1
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 48(x31)
+    li x1, 1
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 52(x31)
+    li x1, 1
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 56(x31)
+    li x1, 1
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 60(x31)
+    li x1, 1
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 64(x31)
+    li x1, 1
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 68(x31)
+    li x1, -1
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 72(x31)
+    li x1, -1
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 76(x31)
+    li x1, -1
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 80(x31)
+    li x1, -1
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 84(x31)
+    li x1, -1
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 88(x31)
+    li x1, -1
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 92(x31)
+    li x1, -1
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 96(x31)
+    li x1, -1
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 100(x31)
+    li x1, -1
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 104(x31)
+    li x1, 2147483647
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 108(x31)
+    li x1, 2147483647
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 112(x31)
+    li x1, 2147483647
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 116(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 120(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 124(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 128(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 132(x31)
+    li x1, 2147483647
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 136(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 140(x31)
+    li x1, -2147483648
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 144(x31)
+    li x1, -2147483648
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 148(x31)
+    li x1, -2147483648
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 152(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 156(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 160(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 164(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 168(x31)
+    li x1, -2147483648
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 172(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 176(x31)
+    li x1, 305419896
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 180(x31)
+    li x1, 305419896
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 184(x31)
+    li x1, 305419896
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 188(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 192(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 196(x31)
+    li x1, 305419896
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 200(x31)
+    li x1, 305419896
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 204(x31)
+    li x1, 305419896
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 208(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 212(x31)
+    li x1, -19088744
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 216(x31)
+    li x1, -19088744
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 220(x31)
+    li x1, -19088744
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 224(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 228(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 232(x31)
+    li x1, -19088744
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 236(x31)
+    li x1, -19088744
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 240(x31)
+    li x1, -19088744
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 244(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 248(x31)
+    li x1, 31
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 252(x31)
+    li x1, 31
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 256(x31)
+    li x1, 31
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 260(x31)
+    li x1, 31
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 264(x31)
+    li x1, 31
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 268(x31)
+    li x1, 31
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 272(x31)
+    li x1, 31
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 276(x31)
+    li x1, 31
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 280(x31)
+    li x1, 31
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 284(x31)
+    li x1, 1431677610
+    li x2, 0
+    add x3, x1, x2
+    sw x3, 288(x31)
+    li x1, 1431677610
+    li x2, 1
+    add x3, x1, x2
+    sw x3, 292(x31)
+    li x1, 1431677610
+    li x2, -1
+    add x3, x1, x2
+    sw x3, 296(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    add x3, x1, x2
+    sw x3, 300(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    add x3, x1, x2
+    sw x3, 304(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    add x3, x1, x2
+    sw x3, 308(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    add x3, x1, x2
+    sw x3, 312(x31)
+    li x1, 1431677610
+    li x2, 31
+    add x3, x1, x2
+    sw x3, 316(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    add x3, x1, x2
+    sw x3, 320(x31)
+    # sub
+    li x1, 0
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 324(x31)
+    li x1, 0
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 328(x31)
+    li x1, 0
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 332(x31)
+    li x1, 0
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 336(x31)
+    li x1, 0
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 340(x31)
+    li x1, 0
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 344(x31)
+    li x1, 0
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 348(x31)
+    li x1, 0
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 352(x31)
+    li x1, 0
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 356(x31)
+    li x1, 1
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 360(x31)
+    li x1, 1
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 364(x31)
+    li x1, 1
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 368(x31)
+    li x1, 1
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 372(x31)
+    li x1, 1
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 376(x31)
+    li x1, 1
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 380(x31)
+    li x1, 1
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 384(x31)
+    li x1, 1
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 388(x31)
+    li x1, 1
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 392(x31)
+    li x1, -1
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 396(x31)
+    li x1, -1
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 400(x31)
+    li x1, -1
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 404(x31)
+    li x1, -1
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 408(x31)
+    li x1, -1
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 412(x31)
+    li x1, -1
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 416(x31)
+    li x1, -1
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 420(x31)
+    li x1, -1
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 424(x31)
+    li x1, -1
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 428(x31)
+    li x1, 2147483647
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 432(x31)
+    li x1, 2147483647
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 436(x31)
+    li x1, 2147483647
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 440(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 444(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 448(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 452(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 456(x31)
+    li x1, 2147483647
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 460(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 464(x31)
+    li x1, -2147483648
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 468(x31)
+    li x1, -2147483648
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 472(x31)
+    li x1, -2147483648
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 476(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 480(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 484(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 488(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 492(x31)
+    li x1, -2147483648
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 496(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 500(x31)
+    li x1, 305419896
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 504(x31)
+    li x1, 305419896
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 508(x31)
+    li x1, 305419896
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 512(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 516(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 520(x31)
+    li x1, 305419896
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 524(x31)
+    li x1, 305419896
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 528(x31)
+    li x1, 305419896
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 532(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 536(x31)
+    li x1, -19088744
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 540(x31)
+    li x1, -19088744
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 544(x31)
+    li x1, -19088744
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 548(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 552(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 556(x31)
+    li x1, -19088744
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 560(x31)
+    li x1, -19088744
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 564(x31)
+    li x1, -19088744
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 568(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 572(x31)
+    li x1, 31
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 576(x31)
+    li x1, 31
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 580(x31)
+    li x1, 31
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 584(x31)
+    li x1, 31
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 588(x31)
+    li x1, 31
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 592(x31)
+    li x1, 31
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 596(x31)
+    li x1, 31
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 600(x31)
+    li x1, 31
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 604(x31)
+    li x1, 31
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 608(x31)
+    li x1, 1431677610
+    li x2, 0
+    sub x3, x1, x2
+    sw x3, 612(x31)
+    li x1, 1431677610
+    li x2, 1
+    sub x3, x1, x2
+    sw x3, 616(x31)
+    li x1, 1431677610
+    li x2, -1
+    sub x3, x1, x2
+    sw x3, 620(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    sub x3, x1, x2
+    sw x3, 624(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    sub x3, x1, x2
+    sw x3, 628(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    sub x3, x1, x2
+    sw x3, 632(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    sub x3, x1, x2
+    sw x3, 636(x31)
+    li x1, 1431677610
+    li x2, 31
+    sub x3, x1, x2
+    sw x3, 640(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    sub x3, x1, x2
+    sw x3, 644(x31)
+    # sll
+    li x1, 0
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 648(x31)
+    li x1, 0
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 652(x31)
+    li x1, 0
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 656(x31)
+    li x1, 0
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 660(x31)
+    li x1, 0
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 664(x31)
+    li x1, 0
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 668(x31)
+    li x1, 0
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 672(x31)
+    li x1, 0
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 676(x31)
+    li x1, 0
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 680(x31)
+    li x1, 1
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 684(x31)
+    li x1, 1
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 688(x31)
+    li x1, 1
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 692(x31)
+    li x1, 1
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 696(x31)
+    li x1, 1
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 700(x31)
+    li x1, 1
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 704(x31)
+    li x1, 1
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 708(x31)
+    li x1, 1
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 712(x31)
+    li x1, 1
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 716(x31)
+    li x1, -1
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 720(x31)
+    li x1, -1
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 724(x31)
+    li x1, -1
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 728(x31)
+    li x1, -1
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 732(x31)
+    li x1, -1
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 736(x31)
+    li x1, -1
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 740(x31)
+    li x1, -1
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 744(x31)
+    li x1, -1
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 748(x31)
+    li x1, -1
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 752(x31)
+    li x1, 2147483647
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 756(x31)
+    li x1, 2147483647
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 760(x31)
+    li x1, 2147483647
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 764(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 768(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 772(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 776(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 780(x31)
+    li x1, 2147483647
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 784(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 788(x31)
+    li x1, -2147483648
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 792(x31)
+    li x1, -2147483648
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 796(x31)
+    li x1, -2147483648
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 800(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 804(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 808(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 812(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 816(x31)
+    li x1, -2147483648
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 820(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 824(x31)
+    li x1, 305419896
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 828(x31)
+    li x1, 305419896
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 832(x31)
+    li x1, 305419896
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 836(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 840(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 844(x31)
+    li x1, 305419896
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 848(x31)
+    li x1, 305419896
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 852(x31)
+    li x1, 305419896
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 856(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 860(x31)
+    li x1, -19088744
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 864(x31)
+    li x1, -19088744
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 868(x31)
+    li x1, -19088744
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 872(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 876(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 880(x31)
+    li x1, -19088744
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 884(x31)
+    li x1, -19088744
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 888(x31)
+    li x1, -19088744
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 892(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 896(x31)
+    li x1, 31
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 900(x31)
+    li x1, 31
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 904(x31)
+    li x1, 31
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 908(x31)
+    li x1, 31
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 912(x31)
+    li x1, 31
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 916(x31)
+    li x1, 31
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 920(x31)
+    li x1, 31
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 924(x31)
+    li x1, 31
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 928(x31)
+    li x1, 31
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 932(x31)
+    li x1, 1431677610
+    li x2, 0
+    sll x3, x1, x2
+    sw x3, 936(x31)
+    li x1, 1431677610
+    li x2, 1
+    sll x3, x1, x2
+    sw x3, 940(x31)
+    li x1, 1431677610
+    li x2, -1
+    sll x3, x1, x2
+    sw x3, 944(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    sll x3, x1, x2
+    sw x3, 948(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    sll x3, x1, x2
+    sw x3, 952(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    sll x3, x1, x2
+    sw x3, 956(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    sll x3, x1, x2
+    sw x3, 960(x31)
+    li x1, 1431677610
+    li x2, 31
+    sll x3, x1, x2
+    sw x3, 964(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    sll x3, x1, x2
+    sw x3, 968(x31)
+    # slt
+    li x1, 0
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 972(x31)
+    li x1, 0
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 976(x31)
+    li x1, 0
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 980(x31)
+    li x1, 0
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 984(x31)
+    li x1, 0
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 988(x31)
+    li x1, 0
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 992(x31)
+    li x1, 0
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 996(x31)
+    li x1, 0
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 1000(x31)
+    li x1, 0
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 1004(x31)
+    li x1, 1
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 1008(x31)
+    li x1, 1
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 1012(x31)
+    li x1, 1
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 1016(x31)
+    li x1, 1
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 1020(x31)
+    li x1, 1
+    li x2, -2147483648
+    slt x3, x1, x2
+    addi x31, x31, 1024
+    sw x3, 0(x31)
+    li x1, 1
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 4(x31)
+    li x1, 1
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 8(x31)
+    li x1, 1
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 12(x31)
+    li x1, 1
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 16(x31)
+    li x1, -1
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 20(x31)
+    li x1, -1
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 24(x31)
+    li x1, -1
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 28(x31)
+    li x1, -1
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 32(x31)
+    li x1, -1
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 36(x31)
+    li x1, -1
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 40(x31)
+    li x1, -1
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 44(x31)
+    li x1, -1
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 48(x31)
+    li x1, -1
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 52(x31)
+    li x1, 2147483647
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 56(x31)
+    li x1, 2147483647
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 60(x31)
+    li x1, 2147483647
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 64(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 68(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 72(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 76(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 80(x31)
+    li x1, 2147483647
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 84(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 88(x31)
+    li x1, -2147483648
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 92(x31)
+    li x1, -2147483648
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 96(x31)
+    li x1, -2147483648
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 100(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 104(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 108(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 112(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 116(x31)
+    li x1, -2147483648
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 120(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 124(x31)
+    li x1, 305419896
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 128(x31)
+    li x1, 305419896
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 132(x31)
+    li x1, 305419896
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 136(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 140(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 144(x31)
+    li x1, 305419896
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 148(x31)
+    li x1, 305419896
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 152(x31)
+    li x1, 305419896
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 156(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 160(x31)
+    li x1, -19088744
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 164(x31)
+    li x1, -19088744
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 168(x31)
+    li x1, -19088744
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 172(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 176(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 180(x31)
+    li x1, -19088744
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 184(x31)
+    li x1, -19088744
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 188(x31)
+    li x1, -19088744
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 192(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 196(x31)
+    li x1, 31
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 200(x31)
+    li x1, 31
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 204(x31)
+    li x1, 31
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 208(x31)
+    li x1, 31
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 212(x31)
+    li x1, 31
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 216(x31)
+    li x1, 31
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 220(x31)
+    li x1, 31
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 224(x31)
+    li x1, 31
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 228(x31)
+    li x1, 31
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 232(x31)
+    li x1, 1431677610
+    li x2, 0
+    slt x3, x1, x2
+    sw x3, 236(x31)
+    li x1, 1431677610
+    li x2, 1
+    slt x3, x1, x2
+    sw x3, 240(x31)
+    li x1, 1431677610
+    li x2, -1
+    slt x3, x1, x2
+    sw x3, 244(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    slt x3, x1, x2
+    sw x3, 248(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    slt x3, x1, x2
+    sw x3, 252(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    slt x3, x1, x2
+    sw x3, 256(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    slt x3, x1, x2
+    sw x3, 260(x31)
+    li x1, 1431677610
+    li x2, 31
+    slt x3, x1, x2
+    sw x3, 264(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    slt x3, x1, x2
+    sw x3, 268(x31)
+    # sltu
+    li x1, 0
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 272(x31)
+    li x1, 0
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 276(x31)
+    li x1, 0
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 280(x31)
+    li x1, 0
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 284(x31)
+    li x1, 0
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 288(x31)
+    li x1, 0
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 292(x31)
+    li x1, 0
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 296(x31)
+    li x1, 0
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 300(x31)
+    li x1, 0
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 304(x31)
+    li x1, 1
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 308(x31)
+    li x1, 1
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 312(x31)
+    li x1, 1
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 316(x31)
+    li x1, 1
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 320(x31)
+    li x1, 1
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 324(x31)
+    li x1, 1
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 328(x31)
+    li x1, 1
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 332(x31)
+    li x1, 1
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 336(x31)
+    li x1, 1
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 340(x31)
+    li x1, -1
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 344(x31)
+    li x1, -1
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 348(x31)
+    li x1, -1
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 352(x31)
+    li x1, -1
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 356(x31)
+    li x1, -1
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 360(x31)
+    li x1, -1
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 364(x31)
+    li x1, -1
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 368(x31)
+    li x1, -1
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 372(x31)
+    li x1, -1
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 376(x31)
+    li x1, 2147483647
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 380(x31)
+    li x1, 2147483647
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 384(x31)
+    li x1, 2147483647
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 388(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 392(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 396(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 400(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 404(x31)
+    li x1, 2147483647
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 408(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 412(x31)
+    li x1, -2147483648
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 416(x31)
+    li x1, -2147483648
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 420(x31)
+    li x1, -2147483648
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 424(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 428(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 432(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 436(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 440(x31)
+    li x1, -2147483648
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 444(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 448(x31)
+    li x1, 305419896
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 452(x31)
+    li x1, 305419896
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 456(x31)
+    li x1, 305419896
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 460(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 464(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 468(x31)
+    li x1, 305419896
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 472(x31)
+    li x1, 305419896
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 476(x31)
+    li x1, 305419896
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 480(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 484(x31)
+    li x1, -19088744
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 488(x31)
+    li x1, -19088744
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 492(x31)
+    li x1, -19088744
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 496(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 500(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 504(x31)
+    li x1, -19088744
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 508(x31)
+    li x1, -19088744
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 512(x31)
+    li x1, -19088744
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 516(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 520(x31)
+    li x1, 31
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 524(x31)
+    li x1, 31
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 528(x31)
+    li x1, 31
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 532(x31)
+    li x1, 31
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 536(x31)
+    li x1, 31
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 540(x31)
+    li x1, 31
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 544(x31)
+    li x1, 31
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 548(x31)
+    li x1, 31
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 552(x31)
+    li x1, 31
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 556(x31)
+    li x1, 1431677610
+    li x2, 0
+    sltu x3, x1, x2
+    sw x3, 560(x31)
+    li x1, 1431677610
+    li x2, 1
+    sltu x3, x1, x2
+    sw x3, 564(x31)
+    li x1, 1431677610
+    li x2, -1
+    sltu x3, x1, x2
+    sw x3, 568(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    sltu x3, x1, x2
+    sw x3, 572(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    sltu x3, x1, x2
+    sw x3, 576(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    sltu x3, x1, x2
+    sw x3, 580(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    sltu x3, x1, x2
+    sw x3, 584(x31)
+    li x1, 1431677610
+    li x2, 31
+    sltu x3, x1, x2
+    sw x3, 588(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    sltu x3, x1, x2
+    sw x3, 592(x31)
+    # xor
+    li x1, 0
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 596(x31)
+    li x1, 0
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 600(x31)
+    li x1, 0
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 604(x31)
+    li x1, 0
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 608(x31)
+    li x1, 0
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 612(x31)
+    li x1, 0
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 616(x31)
+    li x1, 0
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 620(x31)
+    li x1, 0
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 624(x31)
+    li x1, 0
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 628(x31)
+    li x1, 1
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 632(x31)
+    li x1, 1
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 636(x31)
+    li x1, 1
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 640(x31)
+    li x1, 1
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 644(x31)
+    li x1, 1
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 648(x31)
+    li x1, 1
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 652(x31)
+    li x1, 1
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 656(x31)
+    li x1, 1
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 660(x31)
+    li x1, 1
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 664(x31)
+    li x1, -1
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 668(x31)
+    li x1, -1
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 672(x31)
+    li x1, -1
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 676(x31)
+    li x1, -1
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 680(x31)
+    li x1, -1
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 684(x31)
+    li x1, -1
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 688(x31)
+    li x1, -1
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 692(x31)
+    li x1, -1
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 696(x31)
+    li x1, -1
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 700(x31)
+    li x1, 2147483647
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 704(x31)
+    li x1, 2147483647
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 708(x31)
+    li x1, 2147483647
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 712(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 716(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 720(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 724(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 728(x31)
+    li x1, 2147483647
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 732(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 736(x31)
+    li x1, -2147483648
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 740(x31)
+    li x1, -2147483648
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 744(x31)
+    li x1, -2147483648
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 748(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 752(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 756(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 760(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 764(x31)
+    li x1, -2147483648
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 768(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 772(x31)
+    li x1, 305419896
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 776(x31)
+    li x1, 305419896
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 780(x31)
+    li x1, 305419896
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 784(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 788(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 792(x31)
+    li x1, 305419896
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 796(x31)
+    li x1, 305419896
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 800(x31)
+    li x1, 305419896
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 804(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 808(x31)
+    li x1, -19088744
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 812(x31)
+    li x1, -19088744
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 816(x31)
+    li x1, -19088744
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 820(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 824(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 828(x31)
+    li x1, -19088744
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 832(x31)
+    li x1, -19088744
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 836(x31)
+    li x1, -19088744
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 840(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 844(x31)
+    li x1, 31
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 848(x31)
+    li x1, 31
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 852(x31)
+    li x1, 31
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 856(x31)
+    li x1, 31
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 860(x31)
+    li x1, 31
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 864(x31)
+    li x1, 31
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 868(x31)
+    li x1, 31
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 872(x31)
+    li x1, 31
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 876(x31)
+    li x1, 31
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 880(x31)
+    li x1, 1431677610
+    li x2, 0
+    xor x3, x1, x2
+    sw x3, 884(x31)
+    li x1, 1431677610
+    li x2, 1
+    xor x3, x1, x2
+    sw x3, 888(x31)
+    li x1, 1431677610
+    li x2, -1
+    xor x3, x1, x2
+    sw x3, 892(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    xor x3, x1, x2
+    sw x3, 896(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    xor x3, x1, x2
+    sw x3, 900(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    xor x3, x1, x2
+    sw x3, 904(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    xor x3, x1, x2
+    sw x3, 908(x31)
+    li x1, 1431677610
+    li x2, 31
+    xor x3, x1, x2
+    sw x3, 912(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    xor x3, x1, x2
+    sw x3, 916(x31)
+    # srl
+    li x1, 0
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 920(x31)
+    li x1, 0
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 924(x31)
+    li x1, 0
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 928(x31)
+    li x1, 0
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 932(x31)
+    li x1, 0
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 936(x31)
+    li x1, 0
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 940(x31)
+    li x1, 0
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 944(x31)
+    li x1, 0
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 948(x31)
+    li x1, 0
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 952(x31)
+    li x1, 1
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 956(x31)
+    li x1, 1
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 960(x31)
+    li x1, 1
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 964(x31)
+    li x1, 1
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 968(x31)
+    li x1, 1
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 972(x31)
+    li x1, 1
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 976(x31)
+    li x1, 1
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 980(x31)
+    li x1, 1
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 984(x31)
+    li x1, 1
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 988(x31)
+    li x1, -1
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 992(x31)
+    li x1, -1
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 996(x31)
+    li x1, -1
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 1000(x31)
+    li x1, -1
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 1004(x31)
+    li x1, -1
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 1008(x31)
+    li x1, -1
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 1012(x31)
+    li x1, -1
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 1016(x31)
+    li x1, -1
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 1020(x31)
+    li x1, -1
+    li x2, 1431677610
+    srl x3, x1, x2
+    addi x31, x31, 1024
+    sw x3, 0(x31)
+    li x1, 2147483647
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 4(x31)
+    li x1, 2147483647
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 8(x31)
+    li x1, 2147483647
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 12(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 16(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 20(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 24(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 28(x31)
+    li x1, 2147483647
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 32(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 36(x31)
+    li x1, -2147483648
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 40(x31)
+    li x1, -2147483648
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 44(x31)
+    li x1, -2147483648
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 48(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 52(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 56(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 60(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 64(x31)
+    li x1, -2147483648
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 68(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 72(x31)
+    li x1, 305419896
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 76(x31)
+    li x1, 305419896
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 80(x31)
+    li x1, 305419896
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 84(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 88(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 92(x31)
+    li x1, 305419896
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 96(x31)
+    li x1, 305419896
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 100(x31)
+    li x1, 305419896
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 104(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 108(x31)
+    li x1, -19088744
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 112(x31)
+    li x1, -19088744
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 116(x31)
+    li x1, -19088744
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 120(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 124(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 128(x31)
+    li x1, -19088744
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 132(x31)
+    li x1, -19088744
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 136(x31)
+    li x1, -19088744
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 140(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 144(x31)
+    li x1, 31
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 148(x31)
+    li x1, 31
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 152(x31)
+    li x1, 31
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 156(x31)
+    li x1, 31
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 160(x31)
+    li x1, 31
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 164(x31)
+    li x1, 31
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 168(x31)
+    li x1, 31
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 172(x31)
+    li x1, 31
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 176(x31)
+    li x1, 31
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 180(x31)
+    li x1, 1431677610
+    li x2, 0
+    srl x3, x1, x2
+    sw x3, 184(x31)
+    li x1, 1431677610
+    li x2, 1
+    srl x3, x1, x2
+    sw x3, 188(x31)
+    li x1, 1431677610
+    li x2, -1
+    srl x3, x1, x2
+    sw x3, 192(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    srl x3, x1, x2
+    sw x3, 196(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    srl x3, x1, x2
+    sw x3, 200(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    srl x3, x1, x2
+    sw x3, 204(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    srl x3, x1, x2
+    sw x3, 208(x31)
+    li x1, 1431677610
+    li x2, 31
+    srl x3, x1, x2
+    sw x3, 212(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    srl x3, x1, x2
+    sw x3, 216(x31)
+    # sra
+    li x1, 0
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 220(x31)
+    li x1, 0
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 224(x31)
+    li x1, 0
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 228(x31)
+    li x1, 0
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 232(x31)
+    li x1, 0
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 236(x31)
+    li x1, 0
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 240(x31)
+    li x1, 0
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 244(x31)
+    li x1, 0
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 248(x31)
+    li x1, 0
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 252(x31)
+    li x1, 1
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 256(x31)
+    li x1, 1
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 260(x31)
+    li x1, 1
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 264(x31)
+    li x1, 1
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 268(x31)
+    li x1, 1
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 272(x31)
+    li x1, 1
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 276(x31)
+    li x1, 1
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 280(x31)
+    li x1, 1
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 284(x31)
+    li x1, 1
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 288(x31)
+    li x1, -1
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 292(x31)
+    li x1, -1
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 296(x31)
+    li x1, -1
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 300(x31)
+    li x1, -1
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 304(x31)
+    li x1, -1
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 308(x31)
+    li x1, -1
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 312(x31)
+    li x1, -1
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 316(x31)
+    li x1, -1
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 320(x31)
+    li x1, -1
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 324(x31)
+    li x1, 2147483647
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 328(x31)
+    li x1, 2147483647
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 332(x31)
+    li x1, 2147483647
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 336(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 340(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 344(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 348(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 352(x31)
+    li x1, 2147483647
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 356(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 360(x31)
+    li x1, -2147483648
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 364(x31)
+    li x1, -2147483648
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 368(x31)
+    li x1, -2147483648
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 372(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 376(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 380(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 384(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 388(x31)
+    li x1, -2147483648
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 392(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 396(x31)
+    li x1, 305419896
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 400(x31)
+    li x1, 305419896
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 404(x31)
+    li x1, 305419896
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 408(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 412(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 416(x31)
+    li x1, 305419896
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 420(x31)
+    li x1, 305419896
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 424(x31)
+    li x1, 305419896
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 428(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 432(x31)
+    li x1, -19088744
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 436(x31)
+    li x1, -19088744
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 440(x31)
+    li x1, -19088744
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 444(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 448(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 452(x31)
+    li x1, -19088744
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 456(x31)
+    li x1, -19088744
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 460(x31)
+    li x1, -19088744
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 464(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 468(x31)
+    li x1, 31
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 472(x31)
+    li x1, 31
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 476(x31)
+    li x1, 31
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 480(x31)
+    li x1, 31
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 484(x31)
+    li x1, 31
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 488(x31)
+    li x1, 31
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 492(x31)
+    li x1, 31
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 496(x31)
+    li x1, 31
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 500(x31)
+    li x1, 31
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 504(x31)
+    li x1, 1431677610
+    li x2, 0
+    sra x3, x1, x2
+    sw x3, 508(x31)
+    li x1, 1431677610
+    li x2, 1
+    sra x3, x1, x2
+    sw x3, 512(x31)
+    li x1, 1431677610
+    li x2, -1
+    sra x3, x1, x2
+    sw x3, 516(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    sra x3, x1, x2
+    sw x3, 520(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    sra x3, x1, x2
+    sw x3, 524(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    sra x3, x1, x2
+    sw x3, 528(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    sra x3, x1, x2
+    sw x3, 532(x31)
+    li x1, 1431677610
+    li x2, 31
+    sra x3, x1, x2
+    sw x3, 536(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    sra x3, x1, x2
+    sw x3, 540(x31)
+    # or
+    li x1, 0
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 544(x31)
+    li x1, 0
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 548(x31)
+    li x1, 0
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 552(x31)
+    li x1, 0
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 556(x31)
+    li x1, 0
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 560(x31)
+    li x1, 0
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 564(x31)
+    li x1, 0
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 568(x31)
+    li x1, 0
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 572(x31)
+    li x1, 0
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 576(x31)
+    li x1, 1
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 580(x31)
+    li x1, 1
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 584(x31)
+    li x1, 1
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 588(x31)
+    li x1, 1
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 592(x31)
+    li x1, 1
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 596(x31)
+    li x1, 1
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 600(x31)
+    li x1, 1
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 604(x31)
+    li x1, 1
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 608(x31)
+    li x1, 1
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 612(x31)
+    li x1, -1
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 616(x31)
+    li x1, -1
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 620(x31)
+    li x1, -1
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 624(x31)
+    li x1, -1
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 628(x31)
+    li x1, -1
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 632(x31)
+    li x1, -1
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 636(x31)
+    li x1, -1
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 640(x31)
+    li x1, -1
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 644(x31)
+    li x1, -1
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 648(x31)
+    li x1, 2147483647
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 652(x31)
+    li x1, 2147483647
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 656(x31)
+    li x1, 2147483647
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 660(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 664(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 668(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 672(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 676(x31)
+    li x1, 2147483647
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 680(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 684(x31)
+    li x1, -2147483648
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 688(x31)
+    li x1, -2147483648
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 692(x31)
+    li x1, -2147483648
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 696(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 700(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 704(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 708(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 712(x31)
+    li x1, -2147483648
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 716(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 720(x31)
+    li x1, 305419896
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 724(x31)
+    li x1, 305419896
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 728(x31)
+    li x1, 305419896
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 732(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 736(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 740(x31)
+    li x1, 305419896
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 744(x31)
+    li x1, 305419896
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 748(x31)
+    li x1, 305419896
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 752(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 756(x31)
+    li x1, -19088744
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 760(x31)
+    li x1, -19088744
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 764(x31)
+    li x1, -19088744
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 768(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 772(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 776(x31)
+    li x1, -19088744
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 780(x31)
+    li x1, -19088744
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 784(x31)
+    li x1, -19088744
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 788(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 792(x31)
+    li x1, 31
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 796(x31)
+    li x1, 31
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 800(x31)
+    li x1, 31
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 804(x31)
+    li x1, 31
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 808(x31)
+    li x1, 31
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 812(x31)
+    li x1, 31
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 816(x31)
+    li x1, 31
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 820(x31)
+    li x1, 31
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 824(x31)
+    li x1, 31
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 828(x31)
+    li x1, 1431677610
+    li x2, 0
+    or x3, x1, x2
+    sw x3, 832(x31)
+    li x1, 1431677610
+    li x2, 1
+    or x3, x1, x2
+    sw x3, 836(x31)
+    li x1, 1431677610
+    li x2, -1
+    or x3, x1, x2
+    sw x3, 840(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    or x3, x1, x2
+    sw x3, 844(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    or x3, x1, x2
+    sw x3, 848(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    or x3, x1, x2
+    sw x3, 852(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    or x3, x1, x2
+    sw x3, 856(x31)
+    li x1, 1431677610
+    li x2, 31
+    or x3, x1, x2
+    sw x3, 860(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    or x3, x1, x2
+    sw x3, 864(x31)
+    # and
+    li x1, 0
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 868(x31)
+    li x1, 0
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 872(x31)
+    li x1, 0
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 876(x31)
+    li x1, 0
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 880(x31)
+    li x1, 0
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 884(x31)
+    li x1, 0
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 888(x31)
+    li x1, 0
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 892(x31)
+    li x1, 0
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 896(x31)
+    li x1, 0
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 900(x31)
+    li x1, 1
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 904(x31)
+    li x1, 1
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 908(x31)
+    li x1, 1
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 912(x31)
+    li x1, 1
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 916(x31)
+    li x1, 1
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 920(x31)
+    li x1, 1
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 924(x31)
+    li x1, 1
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 928(x31)
+    li x1, 1
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 932(x31)
+    li x1, 1
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 936(x31)
+    li x1, -1
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 940(x31)
+    li x1, -1
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 944(x31)
+    li x1, -1
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 948(x31)
+    li x1, -1
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 952(x31)
+    li x1, -1
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 956(x31)
+    li x1, -1
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 960(x31)
+    li x1, -1
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 964(x31)
+    li x1, -1
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 968(x31)
+    li x1, -1
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 972(x31)
+    li x1, 2147483647
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 976(x31)
+    li x1, 2147483647
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 980(x31)
+    li x1, 2147483647
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 984(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 988(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 992(x31)
+    li x1, 2147483647
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 996(x31)
+    li x1, 2147483647
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 1000(x31)
+    li x1, 2147483647
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 1004(x31)
+    li x1, 2147483647
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 1008(x31)
+    li x1, -2147483648
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 1012(x31)
+    li x1, -2147483648
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 1016(x31)
+    li x1, -2147483648
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 1020(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    and x3, x1, x2
+    addi x31, x31, 1024
+    sw x3, 0(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 4(x31)
+    li x1, -2147483648
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 8(x31)
+    li x1, -2147483648
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 12(x31)
+    li x1, -2147483648
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 16(x31)
+    li x1, -2147483648
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 20(x31)
+    li x1, 305419896
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 24(x31)
+    li x1, 305419896
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 28(x31)
+    li x1, 305419896
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 32(x31)
+    li x1, 305419896
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 36(x31)
+    li x1, 305419896
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 40(x31)
+    li x1, 305419896
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 44(x31)
+    li x1, 305419896
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 48(x31)
+    li x1, 305419896
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 52(x31)
+    li x1, 305419896
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 56(x31)
+    li x1, -19088744
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 60(x31)
+    li x1, -19088744
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 64(x31)
+    li x1, -19088744
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 68(x31)
+    li x1, -19088744
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 72(x31)
+    li x1, -19088744
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 76(x31)
+    li x1, -19088744
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 80(x31)
+    li x1, -19088744
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 84(x31)
+    li x1, -19088744
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 88(x31)
+    li x1, -19088744
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 92(x31)
+    li x1, 31
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 96(x31)
+    li x1, 31
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 100(x31)
+    li x1, 31
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 104(x31)
+    li x1, 31
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 108(x31)
+    li x1, 31
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 112(x31)
+    li x1, 31
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 116(x31)
+    li x1, 31
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 120(x31)
+    li x1, 31
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 124(x31)
+    li x1, 31
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 128(x31)
+    li x1, 1431677610
+    li x2, 0
+    and x3, x1, x2
+    sw x3, 132(x31)
+    li x1, 1431677610
+    li x2, 1
+    and x3, x1, x2
+    sw x3, 136(x31)
+    li x1, 1431677610
+    li x2, -1
+    and x3, x1, x2
+    sw x3, 140(x31)
+    li x1, 1431677610
+    li x2, 2147483647
+    and x3, x1, x2
+    sw x3, 144(x31)
+    li x1, 1431677610
+    li x2, -2147483648
+    and x3, x1, x2
+    sw x3, 148(x31)
+    li x1, 1431677610
+    li x2, 305419896
+    and x3, x1, x2
+    sw x3, 152(x31)
+    li x1, 1431677610
+    li x2, -19088744
+    and x3, x1, x2
+    sw x3, 156(x31)
+    li x1, 1431677610
+    li x2, 31
+    and x3, x1, x2
+    sw x3, 160(x31)
+    li x1, 1431677610
+    li x2, 1431677610
+    and x3, x1, x2
+    sw x3, 164(x31)
+    # addi
+    li x1, 0
+    addi x3, x1, 0
+    sw x3, 168(x31)
+    li x1, 0
+    addi x3, x1, 1
+    sw x3, 172(x31)
+    li x1, 0
+    addi x3, x1, -1
+    sw x3, 176(x31)
+    li x1, 0
+    addi x3, x1, 2047
+    sw x3, 180(x31)
+    li x1, 0
+    addi x3, x1, -2048
+    sw x3, 184(x31)
+    li x1, 0
+    addi x3, x1, 1365
+    sw x3, 188(x31)
+    li x1, 1
+    addi x3, x1, 0
+    sw x3, 192(x31)
+    li x1, 1
+    addi x3, x1, 1
+    sw x3, 196(x31)
+    li x1, 1
+    addi x3, x1, -1
+    sw x3, 200(x31)
+    li x1, 1
+    addi x3, x1, 2047
+    sw x3, 204(x31)
+    li x1, 1
+    addi x3, x1, -2048
+    sw x3, 208(x31)
+    li x1, 1
+    addi x3, x1, 1365
+    sw x3, 212(x31)
+    li x1, -1
+    addi x3, x1, 0
+    sw x3, 216(x31)
+    li x1, -1
+    addi x3, x1, 1
+    sw x3, 220(x31)
+    li x1, -1
+    addi x3, x1, -1
+    sw x3, 224(x31)
+    li x1, -1
+    addi x3, x1, 2047
+    sw x3, 228(x31)
+    li x1, -1
+    addi x3, x1, -2048
+    sw x3, 232(x31)
+    li x1, -1
+    addi x3, x1, 1365
+    sw x3, 236(x31)
+    li x1, 2147483647
+    addi x3, x1, 0
+    sw x3, 240(x31)
+    li x1, 2147483647
+    addi x3, x1, 1
+    sw x3, 244(x31)
+    li x1, 2147483647
+    addi x3, x1, -1
+    sw x3, 248(x31)
+    li x1, 2147483647
+    addi x3, x1, 2047
+    sw x3, 252(x31)
+    li x1, 2147483647
+    addi x3, x1, -2048
+    sw x3, 256(x31)
+    li x1, 2147483647
+    addi x3, x1, 1365
+    sw x3, 260(x31)
+    li x1, -2147483648
+    addi x3, x1, 0
+    sw x3, 264(x31)
+    li x1, -2147483648
+    addi x3, x1, 1
+    sw x3, 268(x31)
+    li x1, -2147483648
+    addi x3, x1, -1
+    sw x3, 272(x31)
+    li x1, -2147483648
+    addi x3, x1, 2047
+    sw x3, 276(x31)
+    li x1, -2147483648
+    addi x3, x1, -2048
+    sw x3, 280(x31)
+    li x1, -2147483648
+    addi x3, x1, 1365
+    sw x3, 284(x31)
+    li x1, 305419896
+    addi x3, x1, 0
+    sw x3, 288(x31)
+    li x1, 305419896
+    addi x3, x1, 1
+    sw x3, 292(x31)
+    li x1, 305419896
+    addi x3, x1, -1
+    sw x3, 296(x31)
+    li x1, 305419896
+    addi x3, x1, 2047
+    sw x3, 300(x31)
+    li x1, 305419896
+    addi x3, x1, -2048
+    sw x3, 304(x31)
+    li x1, 305419896
+    addi x3, x1, 1365
+    sw x3, 308(x31)
+    li x1, -19088744
+    addi x3, x1, 0
+    sw x3, 312(x31)
+    li x1, -19088744
+    addi x3, x1, 1
+    sw x3, 316(x31)
+    li x1, -19088744
+    addi x3, x1, -1
+    sw x3, 320(x31)
+    li x1, -19088744
+    addi x3, x1, 2047
+    sw x3, 324(x31)
+    li x1, -19088744
+    addi x3, x1, -2048
+    sw x3, 328(x31)
+    li x1, -19088744
+    addi x3, x1, 1365
+    sw x3, 332(x31)
+    li x1, 31
+    addi x3, x1, 0
+    sw x3, 336(x31)
+    li x1, 31
+    addi x3, x1, 1
+    sw x3, 340(x31)
+    li x1, 31
+    addi x3, x1, -1
+    sw x3, 344(x31)
+    li x1, 31
+    addi x3, x1, 2047
+    sw x3, 348(x31)
+    li x1, 31
+    addi x3, x1, -2048
+    sw x3, 352(x31)
+    li x1, 31
+    addi x3, x1, 1365
+    sw x3, 356(x31)
+    li x1, 1431677610
+    addi x3, x1, 0
+    sw x3, 360(x31)
+    li x1, 1431677610
+    addi x3, x1, 1
+    sw x3, 364(x31)
+    li x1, 1431677610
+    addi x3, x1, -1
+    sw x3, 368(x31)
+    li x1, 1431677610
+    addi x3, x1, 2047
+    sw x3, 372(x31)
+    li x1, 1431677610
+    addi x3, x1, -2048
+    sw x3, 376(x31)
+    li x1, 1431677610
+    addi x3, x1, 1365
+    sw x3, 380(x31)
+    # slti
+    li x1, 0
+    slti x3, x1, 0
+    sw x3, 384(x31)
+    li x1, 0
+    slti x3, x1, 1
+    sw x3, 388(x31)
+    li x1, 0
+    slti x3, x1, -1
+    sw x3, 392(x31)
+    li x1, 0
+    slti x3, x1, 2047
+    sw x3, 396(x31)
+    li x1, 0
+    slti x3, x1, -2048
+    sw x3, 400(x31)
+    li x1, 0
+    slti x3, x1, 1365
+    sw x3, 404(x31)
+    li x1, 1
+    slti x3, x1, 0
+    sw x3, 408(x31)
+    li x1, 1
+    slti x3, x1, 1
+    sw x3, 412(x31)
+    li x1, 1
+    slti x3, x1, -1
+    sw x3, 416(x31)
+    li x1, 1
+    slti x3, x1, 2047
+    sw x3, 420(x31)
+    li x1, 1
+    slti x3, x1, -2048
+    sw x3, 424(x31)
+    li x1, 1
+    slti x3, x1, 1365
+    sw x3, 428(x31)
+    li x1, -1
+    slti x3, x1, 0
+    sw x3, 432(x31)
+    li x1, -1
+    slti x3, x1, 1
+    sw x3, 436(x31)
+    li x1, -1
+    slti x3, x1, -1
+    sw x3, 440(x31)
+    li x1, -1
+    slti x3, x1, 2047
+    sw x3, 444(x31)
+    li x1, -1
+    slti x3, x1, -2048
+    sw x3, 448(x31)
+    li x1, -1
+    slti x3, x1, 1365
+    sw x3, 452(x31)
+    li x1, 2147483647
+    slti x3, x1, 0
+    sw x3, 456(x31)
+    li x1, 2147483647
+    slti x3, x1, 1
+    sw x3, 460(x31)
+    li x1, 2147483647
+    slti x3, x1, -1
+    sw x3, 464(x31)
+    li x1, 2147483647
+    slti x3, x1, 2047
+    sw x3, 468(x31)
+    li x1, 2147483647
+    slti x3, x1, -2048
+    sw x3, 472(x31)
+    li x1, 2147483647
+    slti x3, x1, 1365
+    sw x3, 476(x31)
+    li x1, -2147483648
+    slti x3, x1, 0
+    sw x3, 480(x31)
+    li x1, -2147483648
+    slti x3, x1, 1
+    sw x3, 484(x31)
+    li x1, -2147483648
+    slti x3, x1, -1
+    sw x3, 488(x31)
+    li x1, -2147483648
+    slti x3, x1, 2047
+    sw x3, 492(x31)
+    li x1, -2147483648
+    slti x3, x1, -2048
+    sw x3, 496(x31)
+    li x1, -2147483648
+    slti x3, x1, 1365
+    sw x3, 500(x31)
+    li x1, 305419896
+    slti x3, x1, 0
+    sw x3, 504(x31)
+    li x1, 305419896
+    slti x3, x1, 1
+    sw x3, 508(x31)
+    li x1, 305419896
+    slti x3, x1, -1
+    sw x3, 512(x31)
+    li x1, 305419896
+    slti x3, x1, 2047
+    sw x3, 516(x31)
+    li x1, 305419896
+    slti x3, x1, -2048
+    sw x3, 520(x31)
+    li x1, 305419896
+    slti x3, x1, 1365
+    sw x3, 524(x31)
+    li x1, -19088744
+    slti x3, x1, 0
+    sw x3, 528(x31)
+    li x1, -19088744
+    slti x3, x1, 1
+    sw x3, 532(x31)
+    li x1, -19088744
+    slti x3, x1, -1
+    sw x3, 536(x31)
+    li x1, -19088744
+    slti x3, x1, 2047
+    sw x3, 540(x31)
+    li x1, -19088744
+    slti x3, x1, -2048
+    sw x3, 544(x31)
+    li x1, -19088744
+    slti x3, x1, 1365
+    sw x3, 548(x31)
+    li x1, 31
+    slti x3, x1, 0
+    sw x3, 552(x31)
+    li x1, 31
+    slti x3, x1, 1
+    sw x3, 556(x31)
+    li x1, 31
+    slti x3, x1, -1
+    sw x3, 560(x31)
+    li x1, 31
+    slti x3, x1, 2047
+    sw x3, 564(x31)
+    li x1, 31
+    slti x3, x1, -2048
+    sw x3, 568(x31)
+    li x1, 31
+    slti x3, x1, 1365
+    sw x3, 572(x31)
+    li x1, 1431677610
+    slti x3, x1, 0
+    sw x3, 576(x31)
+    li x1, 1431677610
+    slti x3, x1, 1
+    sw x3, 580(x31)
+    li x1, 1431677610
+    slti x3, x1, -1
+    sw x3, 584(x31)
+    li x1, 1431677610
+    slti x3, x1, 2047
+    sw x3, 588(x31)
+    li x1, 1431677610
+    slti x3, x1, -2048
+    sw x3, 592(x31)
+    li x1, 1431677610
+    slti x3, x1, 1365
+    sw x3, 596(x31)
+    # sltiu
+    li x1, 0
+    sltiu x3, x1, 0
+    sw x3, 600(x31)
+    li x1, 0
+    sltiu x3, x1, 1
+    sw x3, 604(x31)
+    li x1, 0
+    sltiu x3, x1, -1
+    sw x3, 608(x31)
+    li x1, 0
+    sltiu x3, x1, 2047
+    sw x3, 612(x31)
+    li x1, 0
+    sltiu x3, x1, -2048
+    sw x3, 616(x31)
+    li x1, 0
+    sltiu x3, x1, 1365
+    sw x3, 620(x31)
+    li x1, 1
+    sltiu x3, x1, 0
+    sw x3, 624(x31)
+    li x1, 1
+    sltiu x3, x1, 1
+    sw x3, 628(x31)
+    li x1, 1
+    sltiu x3, x1, -1
+    sw x3, 632(x31)
+    li x1, 1
+    sltiu x3, x1, 2047
+    sw x3, 636(x31)
+    li x1, 1
+    sltiu x3, x1, -2048
+    sw x3, 640(x31)
+    li x1, 1
+    sltiu x3, x1, 1365
+    sw x3, 644(x31)
+    li x1, -1
+    sltiu x3, x1, 0
+    sw x3, 648(x31)
+    li x1, -1
+    sltiu x3, x1, 1
+    sw x3, 652(x31)
+    li x1, -1
+    sltiu x3, x1, -1
+    sw x3, 656(x31)
+    li x1, -1
+    sltiu x3, x1, 2047
+    sw x3, 660(x31)
+    li x1, -1
+    sltiu x3, x1, -2048
+    sw x3, 664(x31)
+    li x1, -1
+    sltiu x3, x1, 1365
+    sw x3, 668(x31)
+    li x1, 2147483647
+    sltiu x3, x1, 0
+    sw x3, 672(x31)
+    li x1, 2147483647
+    sltiu x3, x1, 1
+    sw x3, 676(x31)
+    li x1, 2147483647
+    sltiu x3, x1, -1
+    sw x3, 680(x31)
+    li x1, 2147483647
+    sltiu x3, x1, 2047
+    sw x3, 684(x31)
+    li x1, 2147483647
+    sltiu x3, x1, -2048
+    sw x3, 688(x31)
+    li x1, 2147483647
+    sltiu x3, x1, 1365
+    sw x3, 692(x31)
+    li x1, -2147483648
+    sltiu x3, x1, 0
+    sw x3, 696(x31)
+    li x1, -2147483648
+    sltiu x3, x1, 1
+    sw x3, 700(x31)
+    li x1, -2147483648
+    sltiu x3, x1, -1
+    sw x3, 704(x31)
+    li x1, -2147483648
+    sltiu x3, x1, 2047
+    sw x3, 708(x31)
+    li x1, -2147483648
+    sltiu x3, x1, -2048
+    sw x3, 712(x31)
+    li x1, -2147483648
+    sltiu x3, x1, 1365
+    sw x3, 716(x31)
+    li x1, 305419896
+    sltiu x3, x1, 0
+    sw x3, 720(x31)
+    li x1, 305419896
+    sltiu x3, x1, 1
+    sw x3, 724(x31)
+    li x1, 305419896
+    sltiu x3, x1, -1
+    sw x3, 728(x31)
+    li x1, 305419896
+    sltiu x3, x1, 2047
+    sw x3, 732(x31)
+    li x1, 305419896
+    sltiu x3, x1, -2048
+    sw x3, 736(x31)
+    li x1, 305419896
+    sltiu x3, x1, 1365
+    sw x3, 740(x31)
+    li x1, -19088744
+    sltiu x3, x1, 0
+    sw x3, 744(x31)
+    li x1, -19088744
+    sltiu x3, x1, 1
+    sw x3, 748(x31)
+    li x1, -19088744
+    sltiu x3, x1, -1
+    sw x3, 752(x31)
+    li x1, -19088744
+    sltiu x3, x1, 2047
+    sw x3, 756(x31)
+    li x1, -19088744
+    sltiu x3, x1, -2048
+    sw x3, 760(x31)
+    li x1, -19088744
+    sltiu x3, x1, 1365
+    sw x3, 764(x31)
+    li x1, 31
+    sltiu x3, x1, 0
+    sw x3, 768(x31)
+    li x1, 31
+    sltiu x3, x1, 1
+    sw x3, 772(x31)
+    li x1, 31
+    sltiu x3, x1, -1
+    sw x3, 776(x31)
+    li x1, 31
+    sltiu x3, x1, 2047
+    sw x3, 780(x31)
+    li x1, 31
+    sltiu x3, x1, -2048
+    sw x3, 784(x31)
+    li x1, 31
+    sltiu x3, x1, 1365
+    sw x3, 788(x31)
+    li x1, 1431677610
+    sltiu x3, x1, 0
+    sw x3, 792(x31)
+    li x1, 1431677610
+    sltiu x3, x1, 1
+    sw x3, 796(x31)
+    li x1, 1431677610
+    sltiu x3, x1, -1
+    sw x3, 800(x31)
+    li x1, 1431677610
+    sltiu x3, x1, 2047
+    sw x3, 804(x31)
+    li x1, 1431677610
+    sltiu x3, x1, -2048
+    sw x3, 808(x31)
+    li x1, 1431677610
+    sltiu x3, x1, 1365
+    sw x3, 812(x31)
+    # xori
+    li x1, 0
+    xori x3, x1, 0
+    sw x3, 816(x31)
+    li x1, 0
+    xori x3, x1, 1
+    sw x3, 820(x31)
+    li x1, 0
+    xori x3, x1, -1
+    sw x3, 824(x31)
+    li x1, 0
+    xori x3, x1, 2047
+    sw x3, 828(x31)
+    li x1, 0
+    xori x3, x1, -2048
+    sw x3, 832(x31)
+    li x1, 0
+    xori x3, x1, 1365
+    sw x3, 836(x31)
+    li x1, 1
+    xori x3, x1, 0
+    sw x3, 840(x31)
+    li x1, 1
+    xori x3, x1, 1
+    sw x3, 844(x31)
+    li x1, 1
+    xori x3, x1, -1
+    sw x3, 848(x31)
+    li x1, 1
+    xori x3, x1, 2047
+    sw x3, 852(x31)
+    li x1, 1
+    xori x3, x1, -2048
+    sw x3, 856(x31)
+    li x1, 1
+    xori x3, x1, 1365
+    sw x3, 860(x31)
+    li x1, -1
+    xori x3, x1, 0
+    sw x3, 864(x31)
+    li x1, -1
+    xori x3, x1, 1
+    sw x3, 868(x31)
+    li x1, -1
+    xori x3, x1, -1
+    sw x3, 872(x31)
+    li x1, -1
+    xori x3, x1, 2047
+    sw x3, 876(x31)
+    li x1, -1
+    xori x3, x1, -2048
+    sw x3, 880(x31)
+    li x1, -1
+    xori x3, x1, 1365
+    sw x3, 884(x31)
+    li x1, 2147483647
+    xori x3, x1, 0
+    sw x3, 888(x31)
+    li x1, 2147483647
+    xori x3, x1, 1
+    sw x3, 892(x31)
+    li x1, 2147483647
+    xori x3, x1, -1
+    sw x3, 896(x31)
+    li x1, 2147483647
+    xori x3, x1, 2047
+    sw x3, 900(x31)
+    li x1, 2147483647
+    xori x3, x1, -2048
+    sw x3, 904(x31)
+    li x1, 2147483647
+    xori x3, x1, 1365
+    sw x3, 908(x31)
+    li x1, -2147483648
+    xori x3, x1, 0
+    sw x3, 912(x31)
+    li x1, -2147483648
+    xori x3, x1, 1
+    sw x3, 916(x31)
+    li x1, -2147483648
+    xori x3, x1, -1
+    sw x3, 920(x31)
+    li x1, -2147483648
+    xori x3, x1, 2047
+    sw x3, 924(x31)
+    li x1, -2147483648
+    xori x3, x1, -2048
+    sw x3, 928(x31)
+    li x1, -2147483648
+    xori x3, x1, 1365
+    sw x3, 932(x31)
+    li x1, 305419896
+    xori x3, x1, 0
+    sw x3, 936(x31)
+    li x1, 305419896
+    xori x3, x1, 1
+    sw x3, 940(x31)
+    li x1, 305419896
+    xori x3, x1, -1
+    sw x3, 944(x31)
+    li x1, 305419896
+    xori x3, x1, 2047
+    sw x3, 948(x31)
+    li x1, 305419896
+    xori x3, x1, -2048
+    sw x3, 952(x31)
+    li x1, 305419896
+    xori x3, x1, 1365
+    sw x3, 956(x31)
+    li x1, -19088744
+    xori x3, x1, 0
+    sw x3, 960(x31)
+    li x1, -19088744
+    xori x3, x1, 1
+    sw x3, 964(x31)
+    li x1, -19088744
+    xori x3, x1, -1
+    sw x3, 968(x31)
+    li x1, -19088744
+    xori x3, x1, 2047
+    sw x3, 972(x31)
+    li x1, -19088744
+    xori x3, x1, -2048
+    sw x3, 976(x31)
+    li x1, -19088744
+    xori x3, x1, 1365
+    sw x3, 980(x31)
+    li x1, 31
+    xori x3, x1, 0
+    sw x3, 984(x31)
+    li x1, 31
+    xori x3, x1, 1
+    sw x3, 988(x31)
+    li x1, 31
+    xori x3, x1, -1
+    sw x3, 992(x31)
+    li x1, 31
+    xori x3, x1, 2047
+    sw x3, 996(x31)
+    li x1, 31
+    xori x3, x1, -2048
+    sw x3, 1000(x31)
+    li x1, 31
+    xori x3, x1, 1365
+    sw x3, 1004(x31)
+    li x1, 1431677610
+    xori x3, x1, 0
+    sw x3, 1008(x31)
+    li x1, 1431677610
+    xori x3, x1, 1
+    sw x3, 1012(x31)
+    li x1, 1431677610
+    xori x3, x1, -1
+    sw x3, 1016(x31)
+    li x1, 1431677610
+    xori x3, x1, 2047
+    sw x3, 1020(x31)
+    li x1, 1431677610
+    xori x3, x1, -2048
+    addi x31, x31, 1024
+    sw x3, 0(x31)
+    li x1, 1431677610
+    xori x3, x1, 1365
+    sw x3, 4(x31)
+    # ori
+    li x1, 0
+    ori x3, x1, 0
+    sw x3, 8(x31)
+    li x1, 0
+    ori x3, x1, 1
+    sw x3, 12(x31)
+    li x1, 0
+    ori x3, x1, -1
+    sw x3, 16(x31)
+    li x1, 0
+    ori x3, x1, 2047
+    sw x3, 20(x31)
+    li x1, 0
+    ori x3, x1, -2048
+    sw x3, 24(x31)
+    li x1, 0
+    ori x3, x1, 1365
+    sw x3, 28(x31)
+    li x1, 1
+    ori x3, x1, 0
+    sw x3, 32(x31)
+    li x1, 1
+    ori x3, x1, 1
+    sw x3, 36(x31)
+    li x1, 1
+    ori x3, x1, -1
+    sw x3, 40(x31)
+    li x1, 1
+    ori x3, x1, 2047
+    sw x3, 44(x31)
+    li x1, 1
+    ori x3, x1, -2048
+    sw x3, 48(x31)
+    li x1, 1
+    ori x3, x1, 1365
+    sw x3, 52(x31)
+    li x1, -1
+    ori x3, x1, 0
+    sw x3, 56(x31)
+    li x1, -1
+    ori x3, x1, 1
+    sw x3, 60(x31)
+    li x1, -1
+    ori x3, x1, -1
+    sw x3, 64(x31)
+    li x1, -1
+    ori x3, x1, 2047
+    sw x3, 68(x31)
+    li x1, -1
+    ori x3, x1, -2048
+    sw x3, 72(x31)
+    li x1, -1
+    ori x3, x1, 1365
+    sw x3, 76(x31)
+    li x1, 2147483647
+    ori x3, x1, 0
+    sw x3, 80(x31)
+    li x1, 2147483647
+    ori x3, x1, 1
+    sw x3, 84(x31)
+    li x1, 2147483647
+    ori x3, x1, -1
+    sw x3, 88(x31)
+    li x1, 2147483647
+    ori x3, x1, 2047
+    sw x3, 92(x31)
+    li x1, 2147483647
+    ori x3, x1, -2048
+    sw x3, 96(x31)
+    li x1, 2147483647
+    ori x3, x1, 1365
+    sw x3, 100(x31)
+    li x1, -2147483648
+    ori x3, x1, 0
+    sw x3, 104(x31)
+    li x1, -2147483648
+    ori x3, x1, 1
+    sw x3, 108(x31)
+    li x1, -2147483648
+    ori x3, x1, -1
+    sw x3, 112(x31)
+    li x1, -2147483648
+    ori x3, x1, 2047
+    sw x3, 116(x31)
+    li x1, -2147483648
+    ori x3, x1, -2048
+    sw x3, 120(x31)
+    li x1, -2147483648
+    ori x3, x1, 1365
+    sw x3, 124(x31)
+    li x1, 305419896
+    ori x3, x1, 0
+    sw x3, 128(x31)
+    li x1, 305419896
+    ori x3, x1, 1
+    sw x3, 132(x31)
+    li x1, 305419896
+    ori x3, x1, -1
+    sw x3, 136(x31)
+    li x1, 305419896
+    ori x3, x1, 2047
+    sw x3, 140(x31)
+    li x1, 305419896
+    ori x3, x1, -2048
+    sw x3, 144(x31)
+    li x1, 305419896
+    ori x3, x1, 1365
+    sw x3, 148(x31)
+    li x1, -19088744
+    ori x3, x1, 0
+    sw x3, 152(x31)
+    li x1, -19088744
+    ori x3, x1, 1
+    sw x3, 156(x31)
+    li x1, -19088744
+    ori x3, x1, -1
+    sw x3, 160(x31)
+    li x1, -19088744
+    ori x3, x1, 2047
+    sw x3, 164(x31)
+    li x1, -19088744
+    ori x3, x1, -2048
+    sw x3, 168(x31)
+    li x1, -19088744
+    ori x3, x1, 1365
+    sw x3, 172(x31)
+    li x1, 31
+    ori x3, x1, 0
+    sw x3, 176(x31)
+    li x1, 31
+    ori x3, x1, 1
+    sw x3, 180(x31)
+    li x1, 31
+    ori x3, x1, -1
+    sw x3, 184(x31)
+    li x1, 31
+    ori x3, x1, 2047
+    sw x3, 188(x31)
+    li x1, 31
+    ori x3, x1, -2048
+    sw x3, 192(x31)
+    li x1, 31
+    ori x3, x1, 1365
+    sw x3, 196(x31)
+    li x1, 1431677610
+    ori x3, x1, 0
+    sw x3, 200(x31)
+    li x1, 1431677610
+    ori x3, x1, 1
+    sw x3, 204(x31)
+    li x1, 1431677610
+    ori x3, x1, -1
+    sw x3, 208(x31)
+    li x1, 1431677610
+    ori x3, x1, 2047
+    sw x3, 212(x31)
+    li x1, 1431677610
+    ori x3, x1, -2048
+    sw x3, 216(x31)
+    li x1, 1431677610
+    ori x3, x1, 1365
+    sw x3, 220(x31)
+    # andi
+    li x1, 0
+    andi x3, x1, 0
+    sw x3, 224(x31)
+    li x1, 0
+    andi x3, x1, 1
+    sw x3, 228(x31)
+    li x1, 0
+    andi x3, x1, -1
+    sw x3, 232(x31)
+    li x1, 0
+    andi x3, x1, 2047
+    sw x3, 236(x31)
+    li x1, 0
+    andi x3, x1, -2048
+    sw x3, 240(x31)
+    li x1, 0
+    andi x3, x1, 1365
+    sw x3, 244(x31)
+    li x1, 1
+    andi x3, x1, 0
+    sw x3, 248(x31)
+    li x1, 1
+    andi x3, x1, 1
+    sw x3, 252(x31)
+    li x1, 1
+    andi x3, x1, -1
+    sw x3, 256(x31)
+    li x1, 1
+    andi x3, x1, 2047
+    sw x3, 260(x31)
+    li x1, 1
+    andi x3, x1, -2048
+    sw x3, 264(x31)
+    li x1, 1
+    andi x3, x1, 1365
+    sw x3, 268(x31)
+    li x1, -1
+    andi x3, x1, 0
+    sw x3, 272(x31)
+    li x1, -1
+    andi x3, x1, 1
+    sw x3, 276(x31)
+    li x1, -1
+    andi x3, x1, -1
+    sw x3, 280(x31)
+    li x1, -1
+    andi x3, x1, 2047
+    sw x3, 284(x31)
+    li x1, -1
+    andi x3, x1, -2048
+    sw x3, 288(x31)
+    li x1, -1
+    andi x3, x1, 1365
+    sw x3, 292(x31)
+    li x1, 2147483647
+    andi x3, x1, 0
+    sw x3, 296(x31)
+    li x1, 2147483647
+    andi x3, x1, 1
+    sw x3, 300(x31)
+    li x1, 2147483647
+    andi x3, x1, -1
+    sw x3, 304(x31)
+    li x1, 2147483647
+    andi x3, x1, 2047
+    sw x3, 308(x31)
+    li x1, 2147483647
+    andi x3, x1, -2048
+    sw x3, 312(x31)
+    li x1, 2147483647
+    andi x3, x1, 1365
+    sw x3, 316(x31)
+    li x1, -2147483648
+    andi x3, x1, 0
+    sw x3, 320(x31)
+    li x1, -2147483648
+    andi x3, x1, 1
+    sw x3, 324(x31)
+    li x1, -2147483648
+    andi x3, x1, -1
+    sw x3, 328(x31)
+    li x1, -2147483648
+    andi x3, x1, 2047
+    sw x3, 332(x31)
+    li x1, -2147483648
+    andi x3, x1, -2048
+    sw x3, 336(x31)
+    li x1, -2147483648
+    andi x3, x1, 1365
+    sw x3, 340(x31)
+    li x1, 305419896
+    andi x3, x1, 0
+    sw x3, 344(x31)
+    li x1, 305419896
+    andi x3, x1, 1
+    sw x3, 348(x31)
+    li x1, 305419896
+    andi x3, x1, -1
+    sw x3, 352(x31)
+    li x1, 305419896
+    andi x3, x1, 2047
+    sw x3, 356(x31)
+    li x1, 305419896
+    andi x3, x1, -2048
+    sw x3, 360(x31)
+    li x1, 305419896
+    andi x3, x1, 1365
+    sw x3, 364(x31)
+    li x1, -19088744
+    andi x3, x1, 0
+    sw x3, 368(x31)
+    li x1, -19088744
+    andi x3, x1, 1
+    sw x3, 372(x31)
+    li x1, -19088744
+    andi x3, x1, -1
+    sw x3, 376(x31)
+    li x1, -19088744
+    andi x3, x1, 2047
+    sw x3, 380(x31)
+    li x1, -19088744
+    andi x3, x1, -2048
+    sw x3, 384(x31)
+    li x1, -19088744
+    andi x3, x1, 1365
+    sw x3, 388(x31)
+    li x1, 31
+    andi x3, x1, 0
+    sw x3, 392(x31)
+    li x1, 31
+    andi x3, x1, 1
+    sw x3, 396(x31)
+    li x1, 31
+    andi x3, x1, -1
+    sw x3, 400(x31)
+    li x1, 31
+    andi x3, x1, 2047
+    sw x3, 404(x31)
+    li x1, 31
+    andi x3, x1, -2048
+    sw x3, 408(x31)
+    li x1, 31
+    andi x3, x1, 1365
+    sw x3, 412(x31)
+    li x1, 1431677610
+    andi x3, x1, 0
+    sw x3, 416(x31)
+    li x1, 1431677610
+    andi x3, x1, 1
+    sw x3, 420(x31)
+    li x1, 1431677610
+    andi x3, x1, -1
+    sw x3, 424(x31)
+    li x1, 1431677610
+    andi x3, x1, 2047
+    sw x3, 428(x31)
+    li x1, 1431677610
+    andi x3, x1, -2048
+    sw x3, 432(x31)
+    li x1, 1431677610
+    andi x3, x1, 1365
+    sw x3, 436(x31)
+    # slli
+    li x1, 0
+    slli x3, x1, 0
+    sw x3, 440(x31)
+    li x1, 0
+    slli x3, x1, 1
+    sw x3, 444(x31)
+    li x1, 0
+    slli x3, x1, 4
+    sw x3, 448(x31)
+    li x1, 0
+    slli x3, x1, 15
+    sw x3, 452(x31)
+    li x1, 0
+    slli x3, x1, 31
+    sw x3, 456(x31)
+    li x1, 1
+    slli x3, x1, 0
+    sw x3, 460(x31)
+    li x1, 1
+    slli x3, x1, 1
+    sw x3, 464(x31)
+    li x1, 1
+    slli x3, x1, 4
+    sw x3, 468(x31)
+    li x1, 1
+    slli x3, x1, 15
+    sw x3, 472(x31)
+    li x1, 1
+    slli x3, x1, 31
+    sw x3, 476(x31)
+    li x1, -1
+    slli x3, x1, 0
+    sw x3, 480(x31)
+    li x1, -1
+    slli x3, x1, 1
+    sw x3, 484(x31)
+    li x1, -1
+    slli x3, x1, 4
+    sw x3, 488(x31)
+    li x1, -1
+    slli x3, x1, 15
+    sw x3, 492(x31)
+    li x1, -1
+    slli x3, x1, 31
+    sw x3, 496(x31)
+    li x1, 2147483647
+    slli x3, x1, 0
+    sw x3, 500(x31)
+    li x1, 2147483647
+    slli x3, x1, 1
+    sw x3, 504(x31)
+    li x1, 2147483647
+    slli x3, x1, 4
+    sw x3, 508(x31)
+    li x1, 2147483647
+    slli x3, x1, 15
+    sw x3, 512(x31)
+    li x1, 2147483647
+    slli x3, x1, 31
+    sw x3, 516(x31)
+    li x1, -2147483648
+    slli x3, x1, 0
+    sw x3, 520(x31)
+    li x1, -2147483648
+    slli x3, x1, 1
+    sw x3, 524(x31)
+    li x1, -2147483648
+    slli x3, x1, 4
+    sw x3, 528(x31)
+    li x1, -2147483648
+    slli x3, x1, 15
+    sw x3, 532(x31)
+    li x1, -2147483648
+    slli x3, x1, 31
+    sw x3, 536(x31)
+    li x1, 305419896
+    slli x3, x1, 0
+    sw x3, 540(x31)
+    li x1, 305419896
+    slli x3, x1, 1
+    sw x3, 544(x31)
+    li x1, 305419896
+    slli x3, x1, 4
+    sw x3, 548(x31)
+    li x1, 305419896
+    slli x3, x1, 15
+    sw x3, 552(x31)
+    li x1, 305419896
+    slli x3, x1, 31
+    sw x3, 556(x31)
+    li x1, -19088744
+    slli x3, x1, 0
+    sw x3, 560(x31)
+    li x1, -19088744
+    slli x3, x1, 1
+    sw x3, 564(x31)
+    li x1, -19088744
+    slli x3, x1, 4
+    sw x3, 568(x31)
+    li x1, -19088744
+    slli x3, x1, 15
+    sw x3, 572(x31)
+    li x1, -19088744
+    slli x3, x1, 31
+    sw x3, 576(x31)
+    li x1, 31
+    slli x3, x1, 0
+    sw x3, 580(x31)
+    li x1, 31
+    slli x3, x1, 1
+    sw x3, 584(x31)
+    li x1, 31
+    slli x3, x1, 4
+    sw x3, 588(x31)
+    li x1, 31
+    slli x3, x1, 15
+    sw x3, 592(x31)
+    li x1, 31
+    slli x3, x1, 31
+    sw x3, 596(x31)
+    li x1, 1431677610
+    slli x3, x1, 0
+    sw x3, 600(x31)
+    li x1, 1431677610
+    slli x3, x1, 1
+    sw x3, 604(x31)
+    li x1, 1431677610
+    slli x3, x1, 4
+    sw x3, 608(x31)
+    li x1, 1431677610
+    slli x3, x1, 15
+    sw x3, 612(x31)
+    li x1, 1431677610
+    slli x3, x1, 31
+    sw x3, 616(x31)
+    # srli
+    li x1, 0
+    srli x3, x1, 0
+    sw x3, 620(x31)
+    li x1, 0
+    srli x3, x1, 1
+    sw x3, 624(x31)
+    li x1, 0
+    srli x3, x1, 4
+    sw x3, 628(x31)
+    li x1, 0
+    srli x3, x1, 15
+    sw x3, 632(x31)
+    li x1, 0
+    srli x3, x1, 31
+    sw x3, 636(x31)
+    li x1, 1
+    srli x3, x1, 0
+    sw x3, 640(x31)
+    li x1, 1
+    srli x3, x1, 1
+    sw x3, 644(x31)
+    li x1, 1
+    srli x3, x1, 4
+    sw x3, 648(x31)
+    li x1, 1
+    srli x3, x1, 15
+    sw x3, 652(x31)
+    li x1, 1
+    srli x3, x1, 31
+    sw x3, 656(x31)
+    li x1, -1
+    srli x3, x1, 0
+    sw x3, 660(x31)
+    li x1, -1
+    srli x3, x1, 1
+    sw x3, 664(x31)
+    li x1, -1
+    srli x3, x1, 4
+    sw x3, 668(x31)
+    li x1, -1
+    srli x3, x1, 15
+    sw x3, 672(x31)
+    li x1, -1
+    srli x3, x1, 31
+    sw x3, 676(x31)
+    li x1, 2147483647
+    srli x3, x1, 0
+    sw x3, 680(x31)
+    li x1, 2147483647
+    srli x3, x1, 1
+    sw x3, 684(x31)
+    li x1, 2147483647
+    srli x3, x1, 4
+    sw x3, 688(x31)
+    li x1, 2147483647
+    srli x3, x1, 15
+    sw x3, 692(x31)
+    li x1, 2147483647
+    srli x3, x1, 31
+    sw x3, 696(x31)
+    li x1, -2147483648
+    srli x3, x1, 0
+    sw x3, 700(x31)
+    li x1, -2147483648
+    srli x3, x1, 1
+    sw x3, 704(x31)
+    li x1, -2147483648
+    srli x3, x1, 4
+    sw x3, 708(x31)
+    li x1, -2147483648
+    srli x3, x1, 15
+    sw x3, 712(x31)
+    li x1, -2147483648
+    srli x3, x1, 31
+    sw x3, 716(x31)
+    li x1, 305419896
+    srli x3, x1, 0
+    sw x3, 720(x31)
+    li x1, 305419896
+    srli x3, x1, 1
+    sw x3, 724(x31)
+    li x1, 305419896
+    srli x3, x1, 4
+    sw x3, 728(x31)
+    li x1, 305419896
+    srli x3, x1, 15
+    sw x3, 732(x31)
+    li x1, 305419896
+    srli x3, x1, 31
+    sw x3, 736(x31)
+    li x1, -19088744
+    srli x3, x1, 0
+    sw x3, 740(x31)
+    li x1, -19088744
+    srli x3, x1, 1
+    sw x3, 744(x31)
+    li x1, -19088744
+    srli x3, x1, 4
+    sw x3, 748(x31)
+    li x1, -19088744
+    srli x3, x1, 15
+    sw x3, 752(x31)
+    li x1, -19088744
+    srli x3, x1, 31
+    sw x3, 756(x31)
+    li x1, 31
+    srli x3, x1, 0
+    sw x3, 760(x31)
+    li x1, 31
+    srli x3, x1, 1
+    sw x3, 764(x31)
+    li x1, 31
+    srli x3, x1, 4
+    sw x3, 768(x31)
+    li x1, 31
+    srli x3, x1, 15
+    sw x3, 772(x31)
+    li x1, 31
+    srli x3, x1, 31
+    sw x3, 776(x31)
+    li x1, 1431677610
+    srli x3, x1, 0
+    sw x3, 780(x31)
+    li x1, 1431677610
+    srli x3, x1, 1
+    sw x3, 784(x31)
+    li x1, 1431677610
+    srli x3, x1, 4
+    sw x3, 788(x31)
+    li x1, 1431677610
+    srli x3, x1, 15
+    sw x3, 792(x31)
+    li x1, 1431677610
+    srli x3, x1, 31
+    sw x3, 796(x31)
+    # srai
+    li x1, 0
+    srai x3, x1, 0
+    sw x3, 800(x31)
+    li x1, 0
+    srai x3, x1, 1
+    sw x3, 804(x31)
+    li x1, 0
+    srai x3, x1, 4
+    sw x3, 808(x31)
+    li x1, 0
+    srai x3, x1, 15
+    sw x3, 812(x31)
+    li x1, 0
+    srai x3, x1, 31
+    sw x3, 816(x31)
+    li x1, 1
+    srai x3, x1, 0
+    sw x3, 820(x31)
+    li x1, 1
+    srai x3, x1, 1
+    sw x3, 824(x31)
+    li x1, 1
+    srai x3, x1, 4
+    sw x3, 828(x31)
+    li x1, 1
+    srai x3, x1, 15
+    sw x3, 832(x31)
+    li x1, 1
+    srai x3, x1, 31
+    sw x3, 836(x31)
+    li x1, -1
+    srai x3, x1, 0
+    sw x3, 840(x31)
+    li x1, -1
+    srai x3, x1, 1
+    sw x3, 844(x31)
+    li x1, -1
+    srai x3, x1, 4
+    sw x3, 848(x31)
+    li x1, -1
+    srai x3, x1, 15
+    sw x3, 852(x31)
+    li x1, -1
+    srai x3, x1, 31
+    sw x3, 856(x31)
+    li x1, 2147483647
+    srai x3, x1, 0
+    sw x3, 860(x31)
+    li x1, 2147483647
+    srai x3, x1, 1
+    sw x3, 864(x31)
+    li x1, 2147483647
+    srai x3, x1, 4
+    sw x3, 868(x31)
+    li x1, 2147483647
+    srai x3, x1, 15
+    sw x3, 872(x31)
+    li x1, 2147483647
+    srai x3, x1, 31
+    sw x3, 876(x31)
+    li x1, -2147483648
+    srai x3, x1, 0
+    sw x3, 880(x31)
+    li x1, -2147483648
+    srai x3, x1, 1
+    sw x3, 884(x31)
+    li x1, -2147483648
+    srai x3, x1, 4
+    sw x3, 888(x31)
+    li x1, -2147483648
+    srai x3, x1, 15
+    sw x3, 892(x31)
+    li x1, -2147483648
+    srai x3, x1, 31
+    sw x3, 896(x31)
+    li x1, 305419896
+    srai x3, x1, 0
+    sw x3, 900(x31)
+    li x1, 305419896
+    srai x3, x1, 1
+    sw x3, 904(x31)
+    li x1, 305419896
+    srai x3, x1, 4
+    sw x3, 908(x31)
+    li x1, 305419896
+    srai x3, x1, 15
+    sw x3, 912(x31)
+    li x1, 305419896
+    srai x3, x1, 31
+    sw x3, 916(x31)
+    li x1, -19088744
+    srai x3, x1, 0
+    sw x3, 920(x31)
+    li x1, -19088744
+    srai x3, x1, 1
+    sw x3, 924(x31)
+    li x1, -19088744
+    srai x3, x1, 4
+    sw x3, 928(x31)
+    li x1, -19088744
+    srai x3, x1, 15
+    sw x3, 932(x31)
+    li x1, -19088744
+    srai x3, x1, 31
+    sw x3, 936(x31)
+    li x1, 31
+    srai x3, x1, 0
+    sw x3, 940(x31)
+    li x1, 31
+    srai x3, x1, 1
+    sw x3, 944(x31)
+    li x1, 31
+    srai x3, x1, 4
+    sw x3, 948(x31)
+    li x1, 31
+    srai x3, x1, 15
+    sw x3, 952(x31)
+    li x1, 31
+    srai x3, x1, 31
+    sw x3, 956(x31)
+    li x1, 1431677610
+    srai x3, x1, 0
+    sw x3, 960(x31)
+    li x1, 1431677610
+    srai x3, x1, 1
+    sw x3, 964(x31)
+    li x1, 1431677610
+    srai x3, x1, 4
+    sw x3, 968(x31)
+    li x1, 1431677610
+    srai x3, x1, 15
+    sw x3, 972(x31)
+    li x1, 1431677610
+    srai x3, x1, 31
+    sw x3, 976(x31)
+    # x0 and back-to-back dependences
+    addi x0, x0, 5
+    add x3, x0, x0
+    sw x3, 980(x31)
+    li x1, 7
+    add x2, x1, x1
+    add x3, x2, x1
+    sub x4, x3, x2
+    sw x2, 984(x31)
+    sw x3, 988(x31)
+    sw x4, 992(x31)
+
+    # Halt: M-mode ECALL with mtvec clear
+    csrw mtvec, x0
+    ecall
+
+    .data
+    .align 4
+    .globl begin_signature
+begin_signature:
+    .fill 1273, 4, 0xdeadbeef
+    .globl end_signature
+end_signature:
@@ -0,0 +1,1106 @@
+# Conditional branches, JAL and JALR
+# Signature words are checked against rv32i-ctrl.reference_output.
+    .section .text.init
+    .globl rvtest_entry_point
+rvtest_entry_point:
+    la x31, begin_signature
+    # beq
+    li x1, 0
+    li x2, 0
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 0(x31)
+    li x1, 0
+    li x2, 1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 4(x31)
+    li x1, 0
+    li x2, -1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 8(x31)
+    li x1, 0
+    li x2, 2147483647
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 12(x31)
+    li x1, 0
+    li x2, -2147483648
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 16(x31)
+    li x1, 1
+    li x2, 0
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 20(x31)
+    li x1, 1
+    li x2, 1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 24(x31)
+    li x1, 1
+    li x2, -1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 28(x31)
+    li x1, 1
+    li x2, 2147483647
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 32(x31)
+    li x1, 1
+    li x2, -2147483648
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 36(x31)
+    li x1, -1
+    li x2, 0
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 40(x31)
+    li x1, -1
+    li x2, 1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 44(x31)
+    li x1, -1
+    li x2, -1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 48(x31)
+    li x1, -1
+    li x2, 2147483647
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 52(x31)
+    li x1, -1
+    li x2, -2147483648
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 56(x31)
+    li x1, 2147483647
+    li x2, 0
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 60(x31)
+    li x1, 2147483647
+    li x2, 1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 64(x31)
+    li x1, 2147483647
+    li x2, -1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 68(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 72(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 76(x31)
+    li x1, -2147483648
+    li x2, 0
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 80(x31)
+    li x1, -2147483648
+    li x2, 1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 84(x31)
+    li x1, -2147483648
+    li x2, -1
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 88(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 92(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    li x3, 0
+    beq x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 96(x31)
+    # bne
+    li x1, 0
+    li x2, 0
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 100(x31)
+    li x1, 0
+    li x2, 1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 104(x31)
+    li x1, 0
+    li x2, -1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 108(x31)
+    li x1, 0
+    li x2, 2147483647
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 112(x31)
+    li x1, 0
+    li x2, -2147483648
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 116(x31)
+    li x1, 1
+    li x2, 0
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 120(x31)
+    li x1, 1
+    li x2, 1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 124(x31)
+    li x1, 1
+    li x2, -1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 128(x31)
+    li x1, 1
+    li x2, 2147483647
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 132(x31)
+    li x1, 1
+    li x2, -2147483648
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 136(x31)
+    li x1, -1
+    li x2, 0
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 140(x31)
+    li x1, -1
+    li x2, 1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 144(x31)
+    li x1, -1
+    li x2, -1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 148(x31)
+    li x1, -1
+    li x2, 2147483647
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 152(x31)
+    li x1, -1
+    li x2, -2147483648
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 156(x31)
+    li x1, 2147483647
+    li x2, 0
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 160(x31)
+    li x1, 2147483647
+    li x2, 1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 164(x31)
+    li x1, 2147483647
+    li x2, -1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 168(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 172(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 176(x31)
+    li x1, -2147483648
+    li x2, 0
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 180(x31)
+    li x1, -2147483648
+    li x2, 1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 184(x31)
+    li x1, -2147483648
+    li x2, -1
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 188(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 192(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    li x3, 0
+    bne x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 196(x31)
+    # blt
+    li x1, 0
+    li x2, 0
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 200(x31)
+    li x1, 0
+    li x2, 1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 204(x31)
+    li x1, 0
+    li x2, -1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 208(x31)
+    li x1, 0
+    li x2, 2147483647
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 212(x31)
+    li x1, 0
+    li x2, -2147483648
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 216(x31)
+    li x1, 1
+    li x2, 0
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 220(x31)
+    li x1, 1
+    li x2, 1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 224(x31)
+    li x1, 1
+    li x2, -1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 228(x31)
+    li x1, 1
+    li x2, 2147483647
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 232(x31)
+    li x1, 1
+    li x2, -2147483648
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 236(x31)
+    li x1, -1
+    li x2, 0
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 240(x31)
+    li x1, -1
+    li x2, 1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 244(x31)
+    li x1, -1
+    li x2, -1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 248(x31)
+    li x1, -1
+    li x2, 2147483647
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 252(x31)
+    li x1, -1
+    li x2, -2147483648
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 256(x31)
+    li x1, 2147483647
+    li x2, 0
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 260(x31)
+    li x1, 2147483647
+    li x2, 1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 264(x31)
+    li x1, 2147483647
+    li x2, -1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 268(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 272(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 276(x31)
+    li x1, -2147483648
+    li x2, 0
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 280(x31)
+    li x1, -2147483648
+    li x2, 1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 284(x31)
+    li x1, -2147483648
+    li x2, -1
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 288(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 292(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    li x3, 0
+    blt x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 296(x31)
+    # bge
+    li x1, 0
+    li x2, 0
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 300(x31)
+    li x1, 0
+    li x2, 1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 304(x31)
+    li x1, 0
+    li x2, -1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 308(x31)
+    li x1, 0
+    li x2, 2147483647
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 312(x31)
+    li x1, 0
+    li x2, -2147483648
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 316(x31)
+    li x1, 1
+    li x2, 0
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 320(x31)
+    li x1, 1
+    li x2, 1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 324(x31)
+    li x1, 1
+    li x2, -1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 328(x31)
+    li x1, 1
+    li x2, 2147483647
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 332(x31)
+    li x1, 1
+    li x2, -2147483648
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 336(x31)
+    li x1, -1
+    li x2, 0
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 340(x31)
+    li x1, -1
+    li x2, 1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 344(x31)
+    li x1, -1
+    li x2, -1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 348(x31)
+    li x1, -1
+    li x2, 2147483647
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 352(x31)
+    li x1, -1
+    li x2, -2147483648
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 356(x31)
+    li x1, 2147483647
+    li x2, 0
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 360(x31)
+    li x1, 2147483647
+    li x2, 1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 364(x31)
+    li x1, 2147483647
+    li x2, -1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 368(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 372(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 376(x31)
+    li x1, -2147483648
+    li x2, 0
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 380(x31)
+    li x1, -2147483648
+    li x2, 1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 384(x31)
+    li x1, -2147483648
+    li x2, -1
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 388(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 392(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    li x3, 0
+    bge x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 396(x31)
+    # bltu
+    li x1, 0
+    li x2, 0
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 400(x31)
+    li x1, 0
+    li x2, 1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 404(x31)
+    li x1, 0
+    li x2, -1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 408(x31)
+    li x1, 0
+    li x2, 2147483647
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 412(x31)
+    li x1, 0
+    li x2, -2147483648
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 416(x31)
+    li x1, 1
+    li x2, 0
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 420(x31)
+    li x1, 1
+    li x2, 1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 424(x31)
+    li x1, 1
+    li x2, -1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 428(x31)
+    li x1, 1
+    li x2, 2147483647
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 432(x31)
+    li x1, 1
+    li x2, -2147483648
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 436(x31)
+    li x1, -1
+    li x2, 0
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 440(x31)
+    li x1, -1
+    li x2, 1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 444(x31)
+    li x1, -1
+    li x2, -1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 448(x31)
+    li x1, -1
+    li x2, 2147483647
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 452(x31)
+    li x1, -1
+    li x2, -2147483648
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 456(x31)
+    li x1, 2147483647
+    li x2, 0
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 460(x31)
+    li x1, 2147483647
+    li x2, 1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 464(x31)
+    li x1, 2147483647
+    li x2, -1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 468(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 472(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 476(x31)
+    li x1, -2147483648
+    li x2, 0
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 480(x31)
+    li x1, -2147483648
+    li x2, 1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 484(x31)
+    li x1, -2147483648
+    li x2, -1
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 488(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 492(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    li x3, 0
+    bltu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 496(x31)
+    # bgeu
+    li x1, 0
+    li x2, 0
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 500(x31)
+    li x1, 0
+    li x2, 1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 504(x31)
+    li x1, 0
+    li x2, -1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 508(x31)
+    li x1, 0
+    li x2, 2147483647
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 512(x31)
+    li x1, 0
+    li x2, -2147483648
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 516(x31)
+    li x1, 1
+    li x2, 0
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 520(x31)
+    li x1, 1
+    li x2, 1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 524(x31)
+    li x1, 1
+    li x2, -1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 528(x31)
+    li x1, 1
+    li x2, 2147483647
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 532(x31)
+    li x1, 1
+    li x2, -2147483648
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 536(x31)
+    li x1, -1
+    li x2, 0
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 540(x31)
+    li x1, -1
+    li x2, 1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 544(x31)
+    li x1, -1
+    li x2, -1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 548(x31)
+    li x1, -1
+    li x2, 2147483647
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 552(x31)
+    li x1, -1
+    li x2, -2147483648
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 556(x31)
+    li x1, 2147483647
+    li x2, 0
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 560(x31)
+    li x1, 2147483647
+    li x2, 1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 564(x31)
+    li x1, 2147483647
+    li x2, -1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 568(x31)
+    li x1, 2147483647
+    li x2, 2147483647
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 572(x31)
+    li x1, 2147483647
+    li x2, -2147483648
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 576(x31)
+    li x1, -2147483648
+    li x2, 0
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 580(x31)
+    li x1, -2147483648
+    li x2, 1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 584(x31)
+    li x1, -2147483648
+    li x2, -1
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 588(x31)
+    li x1, -2147483648
+    li x2, 2147483647
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 592(x31)
+    li x1, -2147483648
+    li x2, -2147483648
+    li x3, 0
+    bgeu x1, x2, 1f
+    li x3, 1
+1:
+    sw x3, 596(x31)
+    li x3, 0
+    li x4, 10
+2:
+    addi x3, x3, 3
+    addi x4, x4, -1
+    bnez x4, 2b
+    sw x3, 600(x31)
+    li x3, 0
+    jal x5, 3f
+    li x3, 1
+3:
+    la x6, 3b
+    sub x6, x6, x5
+    sw x3, 604(x31)
+    sw x6, 608(x31)
+    la x7, 4f
+    addi x7, x7, -7
+    li x3, 0
+    jalr x5, 8(x7)
+    li x3, 1
+4:
+    nop
+    la x6, 4b
+    sub x6, x6, x5
+    sw x3, 612(x31)
+    sw x6, 616(x31)
+    la x8, 5f
+    jalr x8, 0(x8)
+5:
+    la x6, 5b
+    sub x6, x8, x6
+    sw x6, 620(x31)
+
+    # Halt: M-mode ECALL with mtvec clear
+    csrw mtvec, x0
+    ecall
+
+    .data
+    .align 4
+    .globl begin_signature
+begin_signature:
+    .fill 156, 4, 0xdeadbeef
+    .globl end_signature
+end_signature:
@@ -0,0 +1,163 @@
+# Byte, halfword and word loads (sign and zero extended) and stores
+# Signature words are checked against rv32i-ldst.reference_output.
+    .section .text.init
+    .globl rvtest_entry_point
+rvtest_entry_point:
+    la x31, begin_signature
+    la x1, load_data
+    lb x3, 0(x1)
+    sw x3, 0(x31)
+    lbu x3, 0(x1)
+    sw x3, 4(x31)
+    lb x3, 1(x1)
+    sw x3, 8(x31)
+    lbu x3, 1(x1)
+    sw x3, 12(x31)
+    lb x3, 2(x1)
+    sw x3, 16(x31)
+    lbu x3, 2(x1)
+    sw x3, 20(x31)
+    lb x3, 3(x1)
+    sw x3, 24(x31)
+    lbu x3, 3(x1)
+    sw x3, 28(x31)
+    lb x3, 4(x1)
+    sw x3, 32(x31)
+    lbu x3, 4(x1)
+    sw x3, 36(x31)
+    lb x3, 5(x1)
+    sw x3, 40(x31)
+    lbu x3, 5(x1)
+    sw x3, 44(x31)
+    lb x3, 6(x1)
+    sw x3, 48(x31)
+    lbu x3, 6(x1)
+    sw x3, 52(x31)
+    lb x3, 7(x1)
+    sw x3, 56(x31)
+    lbu x3, 7(x1)
+    sw x3, 60(x31)
+    lb x3, 8(x1)
+    sw x3, 64(x31)
+    lbu x3, 8(x1)
+    sw x3, 68(x31)
+    lb x3, 9(x1)
+    sw x3, 72(x31)
+    lbu x3, 9(x1)
+    sw x3, 76(x31)
+    lb x3, 10(x1)
+    sw x3, 80(x31)
+    lbu x3, 10(x1)
+    sw x3, 84(x31)
+    lb x3, 11(x1)
+    sw x3, 88(x31)
+    lbu x3, 11(x1)
+    sw x3, 92(x31)
+    lb x3, 12(x1)
+    sw x3, 96(x31)
+    lbu x3, 12(x1)
+    sw x3, 100(x31)
+    lb x3, 13(x1)
+    sw x3, 104(x31)
+    lbu x3, 13(x1)
+    sw x3, 108(x31)
+    lb x3, 14(x1)
+    sw x3, 112(x31)
+    lbu x3, 14(x1)
+    sw x3, 116(x31)
+    lb x3, 15(x1)
+    sw x3, 120(x31)
+    lbu x3, 15(x1)
+    sw x3, 124(x31)
+    lh x3, 0(x1)
+    sw x3, 128(x31)
+    lhu x3, 0(x1)
+    sw x3, 132(x31)
+    lh x3, 2(x1)
+    sw x3, 136(x31)
+    lhu x3, 2(x1)
+    sw x3, 140(x31)
+    lh x3, 4(x1)
+    sw x3, 144(x31)
+    lhu x3, 4(x1)
+    sw x3, 148(x31)
+    lh x3, 6(x1)
+    sw x3, 152(x31)
+    lhu x3, 6(x1)
+    sw x3, 156(x31)
+    lh x3, 8(x1)
+    sw x3, 160(x31)
+    lhu x3, 8(x1)
+    sw x3, 164(x31)
+    lh x3, 10(x1)
+    sw x3, 168(x31)
+    lhu x3, 10(x1)
+    sw x3, 172(x31)
+    lh x3, 12(x1)
+    sw x3, 176(x31)
+    lhu x3, 12(x1)
+    sw x3, 180(x31)
+    lh x3, 14(x1)
+    sw x3, 184(x31)
+    lhu x3, 14(x1)
+    sw x3, 188(x31)
+    lw x3, 0(x1)
+    sw x3, 192(x31)
+    lw x3, 4(x1)
+    sw x3, 196(x31)
+    lw x3, 8(x1)
+    sw x3, 200(x31)
+    lw x3, 12(x1)
+    sw x3, 204(x31)
+    addi x2, x1, 16
+    lw x3, -4(x2)
+    sw x3, 208(x31)
+    lb x3, -16(x2)
+    sw x3, 212(x31)
+    la x1, store_data
+    li x2, -1985229329
+    sw x2, 0(x1)
+    sh x2, 4(x1)
+    sh x2, 6(x1)
+    sb x2, 8(x1)
+    sb x2, 9(x1)
+    li x2, 128
+    sb x2, 10(x1)
+    sb x2, 11(x1)
+    sh x2, 12(x1)
+    sb x2, 15(x1)
+    lw x3, 0(x1)
+    sw x3, 216(x31)
+    lw x3, 4(x1)
+    sw x3, 220(x31)
+    lw x3, 8(x1)
+    sw x3, 224(x31)
+    lw x3, 12(x1)
+    sw x3, 228(x31)
+    li x2, 195948557
+    sw x2, 0(x1)
+    lw x3, 0(x1)
+    lh x4, 2(x1)
+    lbu x5, 1(x1)
+    sw x3, 232(x31)
+    sw x4, 236(x31)
+    sw x5, 240(x31)
+    .data
+    .align 4
+load_data:
+    .byte 0x80, 0x7f, 0x01, 0xff, 0x34, 0x12, 0xcd, 0xab, 0x00, 0x80, 0xff, 0x7f, 0x78, 0x56, 0x34, 0x12
+store_data:
+    .fill 4, 4, 0
+    .section .text.init
+
+    # Halt: M-mode ECALL with mtvec clear
+    csrw mtvec, x0
+    ecall
+
+    .data
+    .align 4
+    .globl begin_signature
+begin_signature:
+    .fill 61, 4, 0xdeadbeef
+    .globl end_signature
+end_signature:
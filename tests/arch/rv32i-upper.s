@@ -0,0 +1,55 @@
+# LUI and AUIPC
+# Signature words are checked against rv32i-upper.reference_output.
+    .section .text.init
+    .globl rvtest_entry_point
+rvtest_entry_point:
+    la x31, begin_signature
+    lui x3, 0
+    sw x3, 0(x31)
+    lui x3, 1
+    sw x3, 4(x31)
+    lui x3, 524288
+    sw x3, 8(x31)
+    lui x3, 1048575
+    sw x3, 12(x31)
+    lui x3, 74565
+    sw x3, 16(x31)
+    lui x3, 524287
+    sw x3, 20(x31)
+1:
+    auipc x3, 0
+    la x4, 1b
+    sub x3, x3, x4
+    sw x3, 24(x31)
+1:
+    auipc x3, 1
+    la x4, 1b
+    sub x3, x3, x4
+    sw x3, 28(x31)
+1:
+    auipc x3, 524288
+    la x4, 1b
+    sub x3, x3, x4
+    sw x3, 32(x31)
+1:
+    auipc x3, 1048575
+    la x4, 1b
+    sub x3, x3, x4
+    sw x3, 36(x31)
+1:
+    auipc x3, 74565
+    la x4, 1b
+    sub x3, x3, x4
+    sw x3, 40(x31)
+
+    # Halt: M-mode ECALL with mtvec clear
+    csrw mtvec, x0
+    ecall
+
+    .data
+    .align 4
+    .globl begin_signature
+begin_signature:
+    .fill 11, 4, 0xdeadbeef
+    .globl end_signature
+end_signature:
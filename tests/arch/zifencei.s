@@ -0,0 +1,58 @@
+# FENCE.I makes stores to instruction memory visible to fetch
+# Signature words are checked against zifencei.reference_output.
+    .section .text.init
+    .globl rvtest_entry_point
+rvtest_entry_point:
+    la x31, begin_signature
+    la x1, 1f
+    la x4, 9f
+    lw x2, 0(x4)
+    sw x2, 0(x1)
+    fence.i
+1:
+    li x3, 1
+    j 8f
+9:
+    li x3, 2
+8:
+    sw x3, 0(x31)
+    la x1, 2f
+    la x4, 3f
+    lw x5, 0(x4)
+    li x3, 0
+    li x6, 4
+4:
+    sw x5, 0(x1)
+    fence.i
+2:
+    addi x3, x3, 1
+    addi x6, x6, -1
+    bnez x6, 4b
+    j 5f
+3:
+    addi x3, x3, 10
+5:
+    sw x3, 4(x31)
+    la x1, fence_data
+    li x2, 99
+    sw x2, 0(x1)
+    fence rw, rw
+    lw x3, 0(x1)
+    sw x3, 8(x31)
+    .data
+    .align 4
+fence_data:
+    .word 0
+    .section .text.init
+
+    # Halt: M-mode ECALL with mtvec clear
+    csrw mtvec, x0
+    ecall
+
+    .data
+    .align 4
+    .globl begin_signature
+begin_signature:
+    .fill 3, 4, 0xdeadbeef
+    .globl end_signature
+end_signature:
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "CPU.hpp"
+#include "Memory.hpp"
+#include "RefModel.hpp"
+#include "RandomProgram.hpp"
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+
+// Lock-step co-simulation: every retirement of the pipelined core is checked
+// against the reference interpreter. `make cosim` raises COSIM_PROGRAMS.
+class CosimTest : public ::testing::Test {
+protected:
+    static constexpr uint32_t MEM_SIZE = 1024 * 1024;
+
+    static uint32_t env_or(const char* name, uint32_t fallback) {
+        const char* value = std::getenv(name);
+        return value ? std::strtoul(value, nullptr, 0) : fallback;
+    }
+
+    static std::string hex(uint32_t v) {
+        std::ostringstream os;
+        os << "0x" << std::hex << std::setw(8) << std::setfill('0') << v;
+        return os.str();
+    }
+
+    static std::string describe(const RetireInfo& r) {
+        std::ostringstream os;
+        os << "pc=" << hex(r.pc) << " " << hex(r.instruction) << " (" << disassemble(r.instruction) << ")";
+        if (r.rd) os << " x" << (int)r.rd << "<-" << hex(r.rd_value);
+        if (r.store_size) os << " mem" << (int)r.store_size * 8 << "[" << hex(r.store_addr) << "]<-" << hex(r.store_value);
+        return os.str();
+    }
+
+    static bool same(const RetireInfo& a, const RetireInfo& b) {
+        return a.pc == b.pc && a.instruction == b.instruction && a.rd == b.rd && a.rd_value == b.rd_value &&
+               a.store_size == b.store_size && a.store_addr == b.store_addr && a.store_value == b.store_value;
+    }
+
+    // Returns an empty string on success, otherwise a readable divergence report
+    static std::string run_lockstep(const RandomProgram& program) {
+        Memory mem(MEM_SIZE);
+        BasicCPU<CosimConfig> cpu(mem);
+        RefModel ref(MEM_SIZE);
+        mem.load_program(program.code);
+        mem.load_program(program.data, RandomProgram::DATA_BASE);
+        ref.load(program.code, 0);
+        ref.load(program.data, RandomProgram::DATA_BASE);
+
+        std::string divergence;
+        uint64_t retired = 0;
+        cpu.set_retire_observer([&](const RetireInfo& dut) {
+            if (!divergence.empty()) return;
+            RetireInfo expected = ref.step();
+            retired++;
+            if (!same(dut, expected)) {
+                divergence = "retirement #" + std::to_string(retired) + "\n  dut: " + describe(dut) +
+                             "\n  ref: " + describe(expected);
+                cpu.request_stop();
+            }
+        });
+
+        StopReason reason = cpu.run(program.code.size() * 8 + 100);
+        if (!divergence.empty()) return divergence;
+        if (reason != StopReason::Halted || !ref.halted) {
+            return "program did not finish (retired " + std::to_string(retired) + ", dut pc=" +
+                   hex(cpu.fetch_pc()) + ", ref pc=" + hex(ref.pc) + ")";
+        }
+        for (int r = 0; r < 32; ++r) {
+            if (cpu.get_reg(r) != ref.regs[r]) {
+                return "final x" + std::to_string(r) + ": dut=" + hex(cpu.get_reg(r)) + " ref=" + hex(ref.regs[r]);
+            }
+        }
+        for (uint32_t a = RandomProgram::DATA_BASE; a < RandomProgram::DATA_BASE + RandomProgram::DATA_SIZE; a += 4) {
+            if (mem.read32(a) != ref.load_value(a, 4)) {
+                return "final mem[" + hex(a) + "]: dut=" + hex(mem.read32(a)) + " ref=" + hex(ref.load_value(a, 4));
+            }
+        }
+        return "";
+    }
+};
+
+TEST_F(CosimTest, RandomPrograms) {
+    uint32_t seed = env_or("COSIM_SEED", 1);
+    uint32_t programs = env_or("COSIM_PROGRAMS", 200);
+    uint32_t length = env_or("COSIM_LENGTH", 300);
+
+    for (uint32_t i = 0; i < programs; ++i) {
+        std::mt19937 rng(seed + i);
+        RandomProgram program = RandomProgram::generate(rng, length);
+        std::string divergence = run_lockstep(program);
+        ASSERT_TRUE(divergence.empty()) << "COSIM_SEED=" << seed + i << " diverged at " << divergence;
+    }
+}
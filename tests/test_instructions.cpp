@@ -1,6 +1,26 @@
 #include <gtest/gtest.h>
 #include "CPU.hpp"
 #include "Memory.hpp"
+#include "FuzzHarness.hpp"
+#include "VirtioBlock.hpp"
+#include "Metrics.hpp"
+#include "Checkpoint.hpp"
+#include "MemTrace.hpp"
+#include "CacheSweep.hpp"
+#include "ArchTest.hpp"
+#include "CommandLine.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <map>
+#include <sys/stat.h>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
 #include <vector>
 
 class InstructionTest : public ::testing::Test {
@@ -340,3 +360,1041 @@ TEST_F(InstructionTest, PerformanceCounters) {
     // mcycle should be 7 (3 + 4 cycles)
     ASSERT_EQ(cpu.get_csr(CPU::CSR_MCYCLE), 7u);
 }
+
+TEST_F(InstructionTest, DebugSingleStep) {
+    // 1. addi x1, x0, 10
+    // 2. addi x2, x1, 5
+    // 3. add  x3, x1, x2
+    std::vector<uint32_t> program = {
+        0x00A00093,
+        0x00508113,
+        0x002081B3
+    };
+    cpu.reset();
+    mem.load_program(program);
+
+    cpu.step_instruction();
+    ASSERT_EQ(cpu.fetch_pc(), 4u);
+    ASSERT_EQ(cpu.get_reg(1), 10u);
+    ASSERT_EQ(cpu.get_reg(2), 0u);
+
+    cpu.step_instruction();
+    ASSERT_EQ(cpu.fetch_pc(), 8u);
+    ASSERT_EQ(cpu.get_reg(2), 15u);
+    ASSERT_EQ(cpu.get_reg(3), 0u);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MINSTRET), 2u);
+}
+
+TEST_F(InstructionTest, DebugBreakpoint) {
+    // 1. addi x1, x0, 1
+    // 2. addi x2, x0, 2
+    // 3. ebreak            ; Debugger breakpoint
+    // 4. addi x3, x0, 3    ; Must not execute before the debugger resumes
+    std::vector<uint32_t> program = {
+        0x00100093,
+        0x00200113,
+        0x00100073,
+        0x00300193
+    };
+    cpu.reset();
+    mem.load_program(program);
+    cpu.set_debug_attached(true);
+
+    ASSERT_EQ(cpu.run(20), StopReason::Breakpoint);
+    ASSERT_EQ(cpu.fetch_pc(), 8u);
+    ASSERT_EQ(cpu.get_reg(2), 2u);
+    ASSERT_EQ(cpu.get_reg(3), 0u);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MINSTRET), 2u); // EBREAK itself does not retire
+}
+
+TEST_F(InstructionTest, DebugWatchpoint) {
+    // 1. addi x1, x0, 0x100
+    // 2. addi x2, x0, 7
+    // 3. sw   x2, 8(x1)    ; Write to the watched word at 0x108
+    std::vector<uint32_t> program = {
+        0x10000093,
+        0x00700113,
+        0x0020A423
+    };
+    ASSERT_TRUE(mem.add_watchpoint(0x108, 4, Memory::WATCH_WRITE));
+    ASSERT_TRUE(mem.add_watchpoint(0x0, 12, Memory::WATCH_READ)); // Fetches are not data reads
+    load_and_run(program);
+
+    uint32_t addr = 0;
+    uint8_t kind = 0;
+    ASSERT_TRUE(mem.take_watch_hit(addr, kind));
+    ASSERT_EQ(addr, 0x108u);
+    ASSERT_EQ(kind, Memory::WATCH_WRITE);
+    ASSERT_FALSE(mem.take_watch_hit(addr, kind));
+}
+
+TEST_F(InstructionTest, RunUntilAndStep) {
+    // 1. addi x1, x0, 1
+    // 2. beq  x0, x0, 8     ; Skip the next instruction
+    // 3. addi x1, x0, 2     ; Fetched on the wrong path, never executed
+    // 4. addi x2, x0, 3
+    // 5. addi x3, x0, 4
+    // 6. ecall              ; Halt
+    std::vector<uint32_t> program = {
+        0x00100093,
+        0x00000463,
+        0x00200093,
+        0x00300113,
+        0x00400193,
+        0x00000073
+    };
+    cpu.reset();
+    mem.load_program(program);
+
+    // 0x8 is fetched on the wrong path and squashed, so the run never stops there
+    ASSERT_EQ(cpu.run_until(0x8, 50), StopReason::Halted);
+    ASSERT_EQ(cpu.get_reg(1), 1u);
+
+    cpu.reset();
+    ASSERT_EQ(cpu.run_until(0xC, 20), StopReason::PcReached);
+    ASSERT_EQ(cpu.fetch_pc(), 0xCu);
+    ASSERT_EQ(cpu.get_reg(1), 1u);
+    ASSERT_EQ(cpu.get_reg(2), 0u);
+
+    ASSERT_EQ(cpu.step_instructions(1), StopReason::StepDone);
+    ASSERT_EQ(cpu.fetch_pc(), 0x10u);
+    ASSERT_EQ(cpu.get_reg(2), 3u);
+    ASSERT_EQ(cpu.get_reg(3), 0u);
+
+    ASSERT_EQ(cpu.run(100), StopReason::Halted);
+    ASSERT_EQ(cpu.get_reg(3), 4u);
+    ASSERT_EQ(cpu.get_instret(), 5u); // The squashed fetch never retires
+}
+
+TEST_F(InstructionTest, EcallHandlerAndMmioCallbacks) {
+    // 1. addi x10, x0, 5
+    // 2. ecall              ; Host doubles a0
+    // 3. addi x11, x10, 1   ; Sees the handler's result
+    // 4. lui  x5, 0x20000   ; Host device at 0x20000000
+    // 5. sw   x11, 0(x5)    ; Device write
+    // 6. lw   x12, 4(x5)    ; Device read
+    std::vector<uint32_t> program = {
+        0x00500513,
+        0x00000073,
+        0x00150593,
+        0x200002B7,
+        0x00B2A023,
+        0x0042A603
+    };
+    uint32_t device_value = 0;
+    mem.map_mmio(0x20000000, 0x10,
+        [](uint32_t offset, uint32_t) { return 0xAB00 | offset; },
+        [&](uint32_t, uint32_t value, uint32_t) { device_value = value; cpu.request_stop(); });
+    cpu.set_ecall_handler([](CPU& c) { c.set_reg(10, c.get_reg(10) * 2); });
+    cpu.reset();
+    mem.load_program(program);
+
+    ASSERT_EQ(cpu.run(100), StopReason::HostRequest);
+    ASSERT_EQ(device_value, 11u);
+    ASSERT_EQ(cpu.get_reg(10), 10u);
+    ASSERT_EQ(cpu.get_reg(12), 0xAB04u);
+    ASSERT_FALSE(cpu.is_halted());
+    ASSERT_EQ(cpu.get_cache_hits() + cpu.get_cache_misses(), 0u); // MMIO bypasses the cache
+}
+
+TEST_F(InstructionTest, Sv32PageFault) {
+    // M-mode setup:
+    // 1.  lui   x5, 0x80000
+    // 2.  addi  x5, x5, 3      ; satp = Sv32, root table at 0x3000
+    // 3.  csrrw x0, satp, x5
+    // 4.  addi  x6, x0, 0x400
+    // 5.  add   x6, x6, x6
+    // 6.  csrrs x0, mstatus, x6 ; MPP = S
+    // 7.  addi  x7, x0, 0x100
+    // 8.  csrrw x0, mepc, x7
+    // 9.  addi  x7, x0, 0x200
+    // 10. csrrw x0, mtvec, x7
+    // 11. mret
+    //
+    // S-mode code at 0x100 (identity megapage):
+    // 1. lui x5, 0x400        ; VA 0x00400000 -> PA 0x5000, read-only
+    // 2. lw  x6, 0(x5)
+    // 3. sw  x6, 4(x5)        ; Store page fault
+    //
+    // M-mode handler at 0x200:
+    // 1. addi x7, x0, 1
+    std::vector<uint32_t> program = {
+        0x800002B7, 0x00328293, 0x18029073, 0x40000313, 0x00630333, 0x30032073,
+        0x10000393, 0x34139073, 0x20000393, 0x30539073, 0x30200073
+    };
+    cpu.reset();
+    mem.load_program(program);
+    mem.load_program({0x004002B7, 0x0002A303, 0x0062A223}, 0x100);
+    mem.load_program({0x00100393}, 0x200);
+    mem.write32(0x3000, PTE_V | PTE_R | PTE_W | PTE_X | PTE_A | PTE_D); // VPN1 0: megapage at 0
+    mem.write32(0x3004, (0x4000 >> 12) << 10 | PTE_V);                // VPN1 1: table at 0x4000
+    mem.write32(0x4000, (0x5000 >> 12) << 10 | PTE_V | PTE_R);         // A is set by the walker
+    mem.write32(0x5000, 0x12345678);
+
+    ASSERT_EQ(cpu.run_until(0x200, 200), StopReason::PcReached);
+    ASSERT_EQ(cpu.get_reg(6), 0x12345678u);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MCAUSE), CPU::CAUSE_STORE_PAGE_FAULT);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MTVAL), 0x00400004u);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MEPC), 0x108u);
+    ASSERT_EQ((cpu.get_csr(CPU::CSR_MSTATUS) & CPU::MSTATUS_MPP) >> 11, CPU::PRIV_S);
+    ASSERT_EQ(cpu.get_privilege(), CPU::PRIV_M);
+    ASSERT_TRUE(mem.read32(0x4000) & PTE_A);
+    ASSERT_FALSE(mem.read32(0x4000) & PTE_D);
+    ASSERT_EQ(mem.read32(0x5004), 0u);
+    ASSERT_GE(cpu.get_dtlb_misses(), 1u);
+    ASSERT_GE(cpu.get_itlb_hits(), 1u);
+    ASSERT_GT(cpu.get_walk_cycles(), 0u);
+}
+
+TEST_F(InstructionTest, DelegatedUserEcall) {
+    // 1. addi  x5, x0, 0x100
+    // 2. csrrw x0, medeleg, x5 ; Delegate ECALL from U-mode
+    // 3. addi  x5, x0, 0x300
+    // 4. csrrw x0, stvec, x5
+    // 5. addi  x5, x0, 0x80
+    // 6. csrrw x0, mepc, x5
+    // 7. mret                  ; MPP is U after reset
+    //
+    // U-mode code at 0x80:
+    // 1. ecall
+    //
+    // S-mode handler at 0x300:
+    // 1. csrrs x7, scause, x0
+    // 2. csrrs x8, sepc, x0
+    // 3. csrrs x9, sstatus, x0
+    std::vector<uint32_t> program = {
+        0x10000293, 0x30229073, 0x30000293, 0x10529073, 0x08000293, 0x34129073, 0x30200073
+    };
+    cpu.reset();
+    mem.load_program(program);
+    mem.load_program({0x00000073}, 0x80);
+    mem.load_program({0x142023F3, 0x14102473, 0x100024F3}, 0x300);
+
+    ASSERT_EQ(cpu.run_until(0x30C, 100), StopReason::PcReached);
+    ASSERT_EQ(cpu.get_reg(7), CPU::CAUSE_ECALL_U_MODE);
+    ASSERT_EQ(cpu.get_reg(8), 0x80u);
+    ASSERT_EQ(cpu.get_reg(9) & CPU::MSTATUS_SPP, 0u); // Came from U-mode
+    ASSERT_EQ(cpu.get_privilege(), CPU::PRIV_S);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MCAUSE), 0u);
+    ASSERT_FALSE(cpu.is_halted());
+}
+
+TEST_F(InstructionTest, ExternalInterrupt) {
+    // 1. addi  x5, x0, 0x100
+    // 2. csrrw x0, mtvec, x5
+    // 3. lui   x5, 0x1
+    // 4. addi  x5, x5, -0x800 ; mie.MEIE
+    // 5. csrrw x0, mie, x5
+    // 6. csrrsi x0, mstatus, 8 ; mstatus.MIE
+    // 7. loop: addi x6, x6, 1
+    // 8. jal   x0, loop
+    //
+    // Handler at 0x100:
+    // 1. csrrs x7, mcause, x0
+    // 2. csrrs x8, mepc, x0
+    // 3. csrrs x9, mip, x0
+    std::vector<uint32_t> program = {
+        0x10000293, 0x30529073, 0x000012B7, 0x80028293, 0x30429073, 0x30046073, 0x00130313, 0xFFDFF06F
+    };
+    cpu.reset();
+    mem.load_program(program);
+    mem.load_program({0x342023F3, 0x34102473, 0x344024F3}, 0x100);
+
+    for (int i = 0; i < 30; ++i) cpu.clock();
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MCAUSE), 0u);
+    cpu.set_irq(CPU::MIP_MEIP, true);
+    ASSERT_EQ(cpu.run_until(0x10C, 100), StopReason::PcReached);
+    ASSERT_EQ(cpu.get_reg(7), CPU::CAUSE_INTERRUPT | 11);
+    ASSERT_TRUE(cpu.get_reg(8) == 0x18u || cpu.get_reg(8) == 0x1Cu);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MSTATUS) & CPU::MSTATUS_MIE, 0u);
+    ASSERT_EQ(cpu.get_reg(9), CPU::MIP_MEIP); // Pending line visible in mip
+    cpu.request_device_poll();
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MIP), CPU::MIP_MEIP); // Debugger view matches; poll requests stay hidden
+}
+
+TEST_F(InstructionTest, HpmCounterOverflow) {
+    // 1.  addi  x5, x0, 0x200
+    // 2.  csrrw x0, mtvec, x5
+    // 3.  addi  x5, x0, 4         ; D-cache miss event
+    // 4.  csrrw x0, mhpmevent3, x5
+    // 5.  addi  x5, x0, -2
+    // 6.  csrrw x0, mhpmcounter3, x5
+    // 7.  addi  x5, x0, -1
+    // 8.  csrrw x0, mhpmcounter3h, x5 ; Overflows on the second miss
+    // 9.  lui   x5, 0x2           ; mie.LCOFIE
+    // 10. csrrw x0, mie, x5
+    // 11. csrrsi x0, mstatus, 8
+    // 12. csrrsi x0, mcountinhibit, 4 ; Freeze minstret
+    // 13. lui   x6, 0x10
+    // 14. lw    x7, 0(x6)
+    // 15. lw    x7, 64(x6)
+    // 16. lw    x7, 128(x6)
+    // 17. lw    x7, 192(x6)
+    // 18. loop: jal x0, loop
+    //
+    // Handler at 0x200:
+    // 1. csrrs x10, mcause, x0
+    // 2. csrrs x11, mhpmevent3, x0
+    // 3. csrrs x12, minstret, x0
+    // 4. csrrs x13, mhpmcounter3, x0
+    // 5. csrrs x14, mhpmevent3h, x0
+    std::vector<uint32_t> program = {
+        0x20000293, 0x30529073, 0x00400293, 0x32329073, 0xFFE00293, 0xB0329073, 0xFFF00293, 0xB8329073, 0x000022B7,
+        0x30429073, 0x30046073, 0x32026073, 0x00010337, 0x00032383, 0x04032383, 0x08032383, 0x0C032383, 0x0000006F
+    };
+    cpu.reset();
+    mem.load_program(program);
+    mem.load_program({0x34202573, 0x323025F3, 0xB0202673, 0xB03026F3, 0x72302773}, 0x200);
+
+    ASSERT_EQ(cpu.run_until(0x214, 200), StopReason::PcReached);
+    ASSERT_EQ(cpu.get_reg(10), CPU::CAUSE_INTERRUPT | 13);
+    ASSERT_EQ(cpu.get_reg(11), HpmCounters::EVENT_DCACHE_MISS);
+    ASSERT_EQ(cpu.get_reg(14), HpmCounters::MHPMEVENTH_OF);
+    ASSERT_LE(cpu.get_reg(13), 1u);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MIP) & CPU::MIP_LCOFIP, CPU::MIP_LCOFIP);
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MINSTRET), cpu.get_reg(12));
+    ASSERT_GT(cpu.get_instret(), cpu.get_reg(12));
+    ASSERT_EQ(cpu.get_csr(CPU::CSR_MCYCLE), cpu.get_cycles());
+}
+
+TEST_F(InstructionTest, UserCounterAccess) {
+    // 1. addi  x5, x0, 0x100
+    // 2. csrrw x0, mtvec, x5
+    // 3. csrrsi x0, mcounteren, 1 ; cycle only
+    // 4. csrrsi x0, scounteren, 1
+    // 5. addi  x5, x0, 0x80
+    // 6. csrrw x0, mepc, x5
+    // 7. mret                    ; To U-mode
+    //
+    // U-mode code at 0x80:
+    // 1. csrrs x6, cycle, x0
+    // 2. csrrs x9, instret, x0   ; Not enabled: illegal instruction
+    //
+    // Handler at 0x100:
+    // 1. csrrs x7, mcause, x0
+    // 2. csrrs x8, mepc, x0
+    std::vector<uint32_t> program = {
+        0x10000293, 0x30529073, 0x3060E073, 0x1060E073, 0x08000293, 0x34129073, 0x30200073
+    };
+    cpu.reset();
+    mem.load_program(program);
+    mem.load_program({0xC0002373, 0xC02024F3}, 0x80);
+    mem.load_program({0x342023F3, 0x34102473}, 0x100);
+
+    ASSERT_EQ(cpu.run_until(0x108, 100), StopReason::PcReached);
+    ASSERT_NE(cpu.get_reg(6), 0u);
+    ASSERT_EQ(cpu.get_reg(9), 0u);
+    ASSERT_EQ(cpu.get_reg(7), CPU::CAUSE_ILLEGAL_INSTRUCTION);
+    ASSERT_EQ(cpu.get_reg(8), 0x84u);
+}
+
+TEST(EnergyTest, CountsPipelineActivity) {
+    // 1. addi x1, x0, 5
+    // 2. addi x2, x0, 7
+    // 3. add  x3, x1, x2
+    // 4. sw   x3, 0x100(x0)
+    // 5. lw   x4, 0x100(x0)
+    // 6. fence
+    // 7. ecall
+    Memory mem;
+    mem.load_program({0x00500093, 0x00700113, 0x002081B3, 0x10302023, 0x10002203, 0x0FF0000F, 0x00000073});
+    BasicCPU<EnergyConfig> cpu(mem);
+    ASSERT_EQ(cpu.run(100), StopReason::Halted);
+
+    EnergyCounters counters = cpu.get_energy_counters();
+    ASSERT_EQ(counters.alu_ops[7], 2u); // OP-IMM
+    ASSERT_EQ(counters.alu_ops[8], 1u); // OP
+    ASSERT_EQ(counters.alu_ops[6], 1u); // STORE
+    ASSERT_EQ(counters.alu_ops[5], 1u); // LOAD
+    ASSERT_EQ(counters.alu_ops[11], 1u); // MISC-MEM
+    ASSERT_EQ(counters.reg_writes, 4u);
+    ASSERT_EQ(counters.mem_bytes, 8u);
+    ASSERT_EQ(counters.dcache_misses, 1u);
+    ASSERT_EQ(counters.dcache_hits, 1u);
+    ASSERT_EQ(counters.cycles, cpu.get_cycles());
+
+    EnergyTable table;
+    table.fetch = table.reg_read = table.dcache_hit = table.dcache_miss = table.flush = table.stall = table.leakage = 0;
+    std::fill(std::begin(table.alu), std::end(table.alu), 0.0);
+    table.reg_write = 1.5;
+    table.mem_byte = 1.0;
+    EnergyReport report = estimate_energy(counters, table);
+    ASSERT_DOUBLE_EQ(report.stage[3], 8.0);
+    ASSERT_DOUBLE_EQ(report.stage[4], 6.0);
+    ASSERT_DOUBLE_EQ(report.total, 14.0);
+    ASSERT_DOUBLE_EQ(report.per_instruction, 14.0 / counters.instret);
+
+    // Disabled configurations keep no counters
+    Memory plain_mem;
+    plain_mem.load_program({0x00500093, 0x00000073});
+    CPU plain(plain_mem);
+    plain.run(100);
+    ASSERT_EQ(plain.get_energy_counters().fetches, 0u);
+    ASSERT_EQ(plain.get_energy_counters().reg_writes, 0u);
+}
+
+TEST(CacheTest, SetAssociativeLRU) {
+    // 2 sets x 2 ways x 16-byte blocks: 0x00, 0x20 and 0x40 all map to set 0
+    Cache<2, 2, 16> cache;
+    ASSERT_FALSE(cache.access(0x00, false));
+    ASSERT_FALSE(cache.access(0x20, false));
+    ASSERT_TRUE(cache.access(0x04, false));  // Same block as 0x00, now most recent
+    ASSERT_FALSE(cache.access(0x40, true));  // Evicts 0x20, the LRU way
+    ASSERT_TRUE(cache.access(0x00, false));
+    ASSERT_FALSE(cache.access(0x20, false));
+    ASSERT_FALSE(cache.access(0x10, false)); // Set 1 is independent
+    ASSERT_EQ(cache.get_hits(), 2u);
+    ASSERT_EQ(cache.get_misses(), 5u);
+}
+
+TEST(FuzzHarnessTest, RestoresSnapshotAndRecordsBranches) {
+    // 1.  lui  x5, 0x1
+    // 2.  lw   x6, 0(x5)      ; Counter in RAM, 0 in the snapshot
+    // 3.  addi x6, x6, 1
+    // 4.  sw   x6, 0(x5)
+    // 5.  addi x7, x0, 1
+    // 6.  bne  x6, x7, crash  ; Counter not restored between inputs
+    // 7.  lbu  x28, 0(x10)    ; First input byte
+    // 8.  addi x29, x0, 'A'
+    // 9.  beq  x28, x29, done
+    // 10. nop
+    // 11. done: ecall
+    // 12. crash: lui x30, 0x20000
+    // 13. sw   x6, 0(x30)
+    // 14. ecall
+    std::vector<uint32_t> firmware = {
+        0x000012B7, 0x0002A303, 0x00130313, 0x0062A023, 0x00100393, 0x00731C63, 0x00054E03,
+        0x04100E93, 0x01DE0463, 0x00000013, 0x00000073, 0x20000F37, 0x006F2023, 0x00000073
+    };
+    FuzzHarness harness(firmware);
+    uint8_t map[64] = {};
+    harness.set_coverage_map(map, sizeof(map));
+
+    const uint8_t hit[] = {'A'};
+    const uint8_t miss[] = {'B', 'C'};
+    ASSERT_EQ(harness.run(hit, sizeof(hit)), FuzzHarness::Outcome::Ok);
+    ASSERT_EQ(map[0x11], 1u); // beq at 0x20 taken
+    ASSERT_EQ(map[0x10], 0u);
+    ASSERT_EQ(harness.run(miss, sizeof(miss)), FuzzHarness::Outcome::Ok);
+    ASSERT_EQ(map[0x10], 1u); // beq at 0x20 not taken
+    ASSERT_EQ(map[0x0A], 2u); // bne at 0x14 not taken on both runs
+    ASSERT_EQ(harness.get_cpu().get_reg(11), 2u);
+    ASSERT_EQ(harness.get_execs(), 2u);
+}
+
+TEST(FuzzHarnessTest, ReportsGuestCrash) {
+    // 1. lui x30, 0x20000
+    // 2. sw  x0, 0(x30)   ; Guest-detected failure
+    // 3. ecall
+    FuzzHarness harness({0x20000F37, 0x000F2023, 0x00000073});
+    ASSERT_EQ(harness.run(nullptr, 0), FuzzHarness::Outcome::Crash);
+}
+
+TEST(VirtioBlockTest, ReadWriteThroughQueue) {
+    char path[] = "/tmp/virtio_blk_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    std::vector<uint8_t> image(4 * VirtioBlock::SECTOR_SIZE, 0);
+    std::fill(image.begin() + VirtioBlock::SECTOR_SIZE, image.begin() + 2 * VirtioBlock::SECTOR_SIZE, 0xAB);
+    ASSERT_EQ(write(fd, image.data(), image.size()), (ssize_t)image.size());
+    close(fd);
+
+    // The guest polls used->idx without touching a device register:
+    // 1. lui  x6, 0x12
+    // 2. addi x7, x0, 2
+    // 3. loop: lhu x5, 2(x6)
+    // 4. bne  x5, x7, loop
+    // 5. ecall
+    Memory mem;
+    mem.load_program({0x00012337, 0x00200393, 0x00235283, 0xFE729EE3, 0x00000073});
+    CPU cpu(mem);
+    std::atomic<int> raised{0};
+    VirtioBlock block(mem, [&raised](bool level) { if (level) raised++; }, [&cpu] { cpu.request_device_poll(); });
+    cpu.set_device_poll([&block] { block.poll(); });
+    ASSERT_TRUE(block.open(path));
+    ASSERT_EQ(block.capacity_sectors(), 4u);
+    ASSERT_EQ(block.mmio_read(0x000, 4), 0x74726976u);
+    ASSERT_EQ(block.mmio_read(0x100, 4), 4u); // Capacity in config space
+
+    // Descriptor table, available ring and used ring for an 8-entry queue
+    const uint32_t desc = 0x10000, avail = 0x11000, used = 0x12000;
+    auto put_desc = [&](uint32_t i, uint32_t addr, uint32_t len, uint16_t flags, uint16_t next) {
+        mem.write32(desc + 16 * i, addr);
+        mem.write32(desc + 16 * i + 4, 0);
+        mem.write32(desc + 16 * i + 8, len);
+        mem.write16(desc + 16 * i + 12, flags);
+        mem.write16(desc + 16 * i + 14, next);
+    };
+    // Request 0: read sector 1 into 0x14000. Request 1: write 0x15000 to sector 3.
+    mem.write32(0x13000, 0); // VIRTIO_BLK_T_IN
+    mem.write32(0x13008, 1);
+    mem.write32(0x13010, 1); // VIRTIO_BLK_T_OUT
+    mem.write32(0x13018, 3);
+    for (uint32_t i = 0; i < VirtioBlock::SECTOR_SIZE; i += 4) mem.write32(0x15000 + i, 0x5A5A5A5A);
+    put_desc(0, 0x13000, 16, 1, 1);
+    put_desc(1, 0x14000, VirtioBlock::SECTOR_SIZE, 3, 2);
+    put_desc(2, 0x16000, 1, 2, 0);
+    put_desc(3, 0x13010, 16, 1, 4);
+    put_desc(4, 0x15000, VirtioBlock::SECTOR_SIZE, 1, 5);
+    put_desc(5, 0x16001, 1, 2, 0);
+    mem.write8(0x16000, 0xFF);
+    mem.write8(0x16001, 0xFF);
+    mem.write16(avail + 4, 0);
+    mem.write16(avail + 6, 3);
+    mem.write16(avail + 2, 2);
+
+    block.mmio_write(0x038, 8, 4); // QueueNum
+    block.mmio_write(0x080, desc, 4);
+    block.mmio_write(0x090, avail, 4);
+    block.mmio_write(0x0A0, used, 4);
+    block.mmio_write(0x044, 1, 4); // QueueReady
+    block.mmio_write(0x070, 0xF, 4); // DRIVER_OK
+    block.mmio_write(0x050, 0, 4); // QueueNotify
+    ASSERT_EQ(cpu.run(100000000), StopReason::Halted);
+    block.wait_idle();
+
+    ASSERT_EQ(mem.read16(used + 2), 2u);
+    ASSERT_EQ(mem.read8(0x16000), 0u);
+    ASSERT_EQ(mem.read8(0x16001), 0u);
+    ASSERT_EQ(mem.read32(0x14000), 0xABABABABu);
+    ASSERT_EQ(mem.read32(0x14000 + VirtioBlock::SECTOR_SIZE - 4), 0xABABABABu);
+    ASSERT_GE(raised.load(), 1);
+    ASSERT_EQ(block.mmio_read(0x060, 4), 1u);
+    block.mmio_write(0x064, 1, 4); // InterruptACK
+    ASSERT_EQ(block.mmio_read(0x060, 4), 0u);
+
+    VirtioBlock::Stats stats = block.get_stats();
+    ASSERT_EQ(stats.reads, 1u);
+    ASSERT_EQ(stats.writes, 1u);
+    ASSERT_EQ(stats.errors, 0u);
+    ASSERT_EQ(stats.bytes_read, VirtioBlock::SECTOR_SIZE);
+
+    uint8_t sector[VirtioBlock::SECTOR_SIZE];
+    fd = ::open(path, O_RDONLY);
+    ASSERT_EQ(pread(fd, sector, sizeof(sector), 3 * VirtioBlock::SECTOR_SIZE), (ssize_t)sizeof(sector));
+    close(fd);
+    unlink(path);
+    ASSERT_EQ(sector[0], 0x5A);
+    ASSERT_EQ(sector[VirtioBlock::SECTOR_SIZE - 1], 0x5A);
+}
+
+TEST(MetricsTest, SeqlockReadsAreConsistent) {
+    MetricsPublisher publisher;
+    MetricsSample sample;
+    ASSERT_EQ(publisher.read(sample), 0u); // Nothing published yet
+
+    // Every published sample has all counters equal; a torn read would mix two
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (uint64_t i = 1; i <= 200000; ++i) publisher.publish({i, i, i, i, (double)i});
+        done = true;
+    });
+    uint64_t last = 0;
+    while (!done) {
+        publisher.read(sample);
+        ASSERT_EQ(sample.instret, sample.cycles);
+        ASSERT_EQ(sample.cache_hits, sample.cycles);
+        ASSERT_EQ(sample.cache_misses, sample.cycles);
+        ASSERT_EQ(sample.host_seconds, (double)sample.cycles);
+        ASSERT_GE(sample.cycles, last);
+        last = sample.cycles;
+    }
+    writer.join();
+    ASSERT_EQ(publisher.read(sample), 400000u);
+    ASSERT_EQ(sample.cycles, 200000u);
+}
+
+TEST(MetricsTest, FormatsIntervalRates) {
+    MetricsSample prev{1000, 500, 90, 10, 1.0};
+    MetricsSample now{3000, 1500, 170, 30, 2.0};
+    ASSERT_EQ(MetricsSampler::format_csv(now, prev), "2.000,3000,1500,0.5000,80.00,0.00");
+    ASSERT_EQ(MetricsSampler::format_json(now, prev),
+              "{\"time_s\":2.000,\"cycles\":3000,\"instret\":1500,\"ipc\":0.5000,\"cache_hit_rate\":80.00,\"mips\":0.00}");
+}
+
+TEST(MetricsTest, CacheCountersPast32BitsBetweenSamples) {
+    // The D-cache counters are 64-bit, so a multi-hour run crossing 4G
+    // accesses between two samples still gives a sane interval hit rate
+    static_assert(std::is_same_v<decltype(std::declval<CPU>().get_cache_hits()), uint64_t>, "cache hits must not wrap");
+    static_assert(std::is_same_v<decltype(std::declval<CPU>().get_cache_misses()), uint64_t>, "cache misses must not wrap");
+    MetricsSample prev{1000, 500, 0xFFFFFFC0ull, 0xFFFFFFF0ull, 1.0};
+    MetricsSample now{3000, 1500, 0x100000020ull, 0x100000010ull, 2.0};
+    ASSERT_EQ(MetricsSampler::format_csv(now, prev), "2.000,3000,1500,0.5000,75.00,0.00");
+}
+
+TEST(CheckpointTest, IncrementalChainResumes) {
+    // 1. addi x1, x0, 0
+    // 2. loop: addi x1, x1, 1
+    // 3. sw   x1, 0x400(x0)
+    // 4. jal  x0, loop
+    const std::vector<uint32_t> program = {0x00000093, 0x00108093, 0x40102023, 0xFF9FF06F};
+    char dir_template[] = "/tmp/ckpt_test_XXXXXX";
+    std::string dir = mkdtemp(dir_template);
+
+    Memory mem;
+    mem.load_program(program);
+    CPU cpu(mem);
+    uint32_t first_x1 = 0;
+    {
+        Checkpointer checkpointer(mem, dir, DefaultConfig::name);
+        ASSERT_TRUE(checkpointer.open());
+        for (int i = 0; i < 2; ++i) {
+            cpu.run(100);
+            cpu.drain();
+            cpu.resume();
+            if (i == 0) first_x1 = cpu.get_reg(1);
+            StateWriter state;
+            cpu.save_state(state);
+            checkpointer.capture(std::move(state.data));
+        }
+        checkpointer.flush();
+        ASSERT_EQ(checkpointer.get_count(), 2u);
+    }
+
+    // The second checkpoint only carries the page written since the first
+    struct stat full_stat, incremental_stat;
+    ASSERT_EQ(stat((dir + "/ckpt-000001.bin").c_str(), &full_stat), 0);
+    ASSERT_EQ(stat((dir + "/ckpt-000002.bin").c_str(), &incremental_stat), 0);
+    ASSERT_LT(incremental_stat.st_size, 8 * 1024);
+    ASSERT_GT(full_stat.st_size, 1024 * 1024);
+
+    Memory restored_mem;
+    CPU restored(restored_mem);
+    std::vector<uint8_t> state;
+    uint32_t sequence = 0;
+    std::string error;
+    ASSERT_TRUE(Checkpointer::resume(dir, DefaultConfig::name, restored_mem, state, sequence, error)) << error;
+    StateReader in(state.data(), state.size());
+    ASSERT_TRUE(restored.load_state(in));
+    ASSERT_EQ(sequence, 2u);
+    ASSERT_EQ(restored.get_reg(1), cpu.get_reg(1));
+    ASSERT_EQ(restored_mem.read32(0x400), mem.read32(0x400));
+    ASSERT_EQ(restored.get_cycles(), cpu.get_cycles());
+    ASSERT_EQ(restored.fetch_pc(), cpu.fetch_pc());
+
+    // Both continue identically
+    cpu.run(57);
+    restored.run(57);
+    ASSERT_EQ(restored.get_reg(1), cpu.get_reg(1));
+    ASSERT_EQ(restored.get_cache_hits(), cpu.get_cache_hits());
+
+    // A torn newest file falls back to the previous checkpoint
+    ASSERT_EQ(truncate((dir + "/ckpt-000002.bin").c_str(), 100), 0);
+    Memory fallback_mem;
+    ASSERT_TRUE(Checkpointer::resume(dir, DefaultConfig::name, fallback_mem, state, sequence, error)) << error;
+    ASSERT_EQ(sequence, 1u);
+    CPU fallback(fallback_mem);
+    StateReader fallback_in(state.data(), state.size());
+    ASSERT_TRUE(fallback.load_state(fallback_in));
+    ASSERT_EQ(fallback.get_reg(1), first_x1);
+    ASSERT_FALSE(Checkpointer::resume(dir, TraceConfig::name, fallback_mem, state, sequence, error));
+
+    unlink((dir + "/ckpt-000001.bin").c_str());
+    rmdir(dir.c_str());
+}
+
+TEST(VectorTest, StripMinedLoopReductionAndStrides) {
+    // 1.  addi x10, x0, 0x100       ; a[i] = i
+    // 2.  addi x11, x0, 0x200       ; b[i] = 10 * i
+    // 3.  addi x12, x0, 0x300       ; c[i] = 3 * (a[i] + b[i])
+    // 4.  addi x5, x0, 10
+    // 5.  addi x13, x0, 3
+    // 6.  loop: vsetvli x6, x5, e32, m2, ta, ma
+    // 7.  vle32.v v2, (x10)
+    // 8.  vle32.v v4, (x11)
+    // 9.  vadd.vv v6, v2, v4
+    // 10. vmul.vx v6, v6, x13
+    // 11. vse32.v v6, (x12)
+    // 12. slli x7, x6, 2
+    // 13-15. add x10/x11/x12, x10/x11/x12, x7
+    // 16. sub  x5, x5, x6
+    // 17. bne  x5, x0, loop
+    // 18. addi x14, x0, 10
+    // 19. addi x12, x0, 0x300
+    // 20. vsetvli x0, x14, e32, m4, ta, ma
+    // 21. vle32.v v8, (x12)
+    // 22. vmv.s.x v12, x0
+    // 23. vredsum.vs v12, v8, v12
+    // 24. vmv.x.s x20, v12
+    // 25. addi x15, x0, 8
+    // 26. vsetivli x0, 4, e32, m1, tu, mu
+    // 27. vlse32.v v1, (x12), x15   ; c[0], c[2], c[4], c[6]
+    // 28. addi x16, x0, 100
+    // 29. vmsgtu.vx v0, v1, x16
+    // 30. vadd.vi v1, v1, 1, v0.t
+    // 31. addi x17, x0, 0x400
+    // 32. vse32.v v1, (x17)
+    // 33. csrr x21, vl
+    // 34. csrr x22, vlenb
+    // 35. ecall
+    Memory mem;
+    mem.load_program({0x10000513, 0x20000593, 0x30000613, 0x00A00293, 0x00300693, 0x0D12F357, 0x02056107,
+                      0x0205E207, 0x02220357, 0x9666E357, 0x02066327, 0x00231393, 0x00750533, 0x007585B3,
+                      0x00760633, 0x406282B3, 0xFC029AE3, 0x00A00713, 0x30000613, 0x0D277057, 0x02066407,
+                      0x42006657, 0x02862657, 0x42C02A57, 0x00800793, 0xC1027057, 0x0AF66087, 0x06400813,
+                      0x7A184057, 0x0010B0D7, 0x40000893, 0x0208E0A7, 0xC2002AF3, 0xC2202B73, 0x00000073});
+    for (uint32_t i = 0; i < 10; ++i) {
+        mem.write32(0x100 + 4 * i, i);
+        mem.write32(0x200 + 4 * i, 10 * i);
+    }
+    BasicCPU<VectorConfig> cpu(mem);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        ASSERT_EQ(mem.read32(0x300 + 4 * i), 33 * i) << "element " << i;
+    }
+    ASSERT_EQ(mem.read32(0x328), 0u); // Past the last strip
+    ASSERT_EQ(cpu.get_reg(20), 33u * 45);
+    ASSERT_EQ(mem.read32(0x400), 0u);
+    ASSERT_EQ(mem.read32(0x404), 66u);
+    ASSERT_EQ(mem.read32(0x408), 133u); // Only elements above 100 were incremented
+    ASSERT_EQ(mem.read32(0x40C), 199u);
+    ASSERT_EQ(cpu.get_reg(21), 4u);
+    ASSERT_EQ(cpu.get_reg(22), VectorConfig::vlen / 8);
+}
+
+TEST(VectorTest, SixteenBitMultiplyWraps) {
+    // 1. addi x10, x0, 0x100
+    // 2. addi x11, x0, 0x200
+    // 3. vsetivli x0, 4, e16, m1, ta, ma
+    // 4. vle16.v v1, (x10)
+    // 5. vmul.vv v2, v1, v1
+    // 6. vmacc.vv v2, v1, v1
+    // 7. vse16.v v2, (x11)
+    // 8. ecall
+    Memory mem;
+    mem.load_program({0x10000513, 0x20000593, 0xCC827057, 0x02055087, 0x9610A157, 0xB610A157, 0x0205D127, 0x00000073});
+    const uint16_t values[] = {0xFFFF, 0x8001, 0x00FF, 0x1234};
+    for (uint32_t i = 0; i < 4; ++i) mem.write16(0x100 + 2 * i, values[i]);
+    BasicCPU<VectorConfig> cpu(mem);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+
+    // Products past INT_MAX wrap modulo 2^16
+    const uint16_t expected[] = {0x0002, 0x0002, 0xFC02, 0xB520};
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_EQ(mem.read16(0x200 + 2 * i), expected[i]) << "element " << i;
+    }
+}
+
+TEST(VectorTest, TailUndisturbedAfterHostSimd) {
+    // 1.  addi x10, x0, 0x100
+    // 2.  addi x11, x0, 0x300
+    // 3.  addi x5, x0, 32
+    // 4.  vsetvli x0, x5, e8, m2, tu, mu
+    // 5.  vle8.v v4, (x10)
+    // 6.  addi x5, x0, 20
+    // 7.  vsetvli x0, x5, e8, m2, tu, mu
+    // 8.  vadd.vv v4, v4, v4        ; 16 bytes on the host SIMD path, 4 scalar
+    // 9.  addi x5, x0, 32
+    // 10. vsetvli x0, x5, e8, m2, tu, mu
+    // 11. vse8.v v4, (x11)
+    // 12. ecall
+    Memory mem;
+    mem.load_program({0x10000513, 0x30000593, 0x02000293, 0x0012F057, 0x02050207, 0x01400293, 0x0012F057,
+                      0x02420257, 0x02000293, 0x0012F057, 0x02058227, 0x00000073});
+    for (uint32_t i = 0; i < 32; ++i) {
+        mem.write8(0x100 + i, 100 + i);
+    }
+    BasicCPU<VectorConfig> cpu(mem);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+    for (uint32_t i = 0; i < 32; ++i) {
+        uint8_t expected = i < 20 ? (uint8_t)(2 * (100 + i)) : 100 + i;
+        ASSERT_EQ(mem.read8(0x300 + i), expected) << "element " << i;
+    }
+}
+
+TEST(VectorTest, CycleCostFollowsVlAndLanes) {
+    // 1. addi x5, x0, <avl>
+    // 2. vsetvli x0, x5, e32, m4, ta, ma
+    // 3-6. vadd.vv v8, v8, v8
+    // 7. ecall
+    auto cycles_for = [](uint32_t avl) {
+        Memory mem;
+        mem.load_program({0x00000293 | (avl << 20), 0x0D22F057, 0x02840457, 0x02840457, 0x02840457, 0x02840457,
+                          0x00000073});
+        BasicCPU<VectorConfig> cpu(mem);
+        cpu.run(1000);
+        return cpu.get_cycles();
+    };
+    // Four lanes: 16 elements take four cycles each, 4 elements one
+    ASSERT_EQ(cycles_for(16) - cycles_for(4), 4u * 3);
+}
+
+TEST(VectorTest, UnsupportedVtypeSetsVill) {
+    // 1.  addi x1, x0, 32
+    // 2.  csrrw x0, mtvec, x1
+    // 3.  addi x5, x0, 8
+    // 4.  vsetvli x6, x5, e64, m1, ta, ma   ; ELEN is 32
+    // 5.  csrr x7, vtype
+    // 6.  vadd.vv v8, v8, v8               ; Illegal with vill set
+    // 7.  addi x8, x0, 1
+    // 8.  nop
+    // 9.  handler: csrr x9, mcause
+    // 10. csrrw x0, mtvec, x0
+    // 11. ecall
+    Memory mem;
+    mem.load_program({0x02000093, 0x30509073, 0x00800293, 0x0D82F357, 0xC21023F3, 0x02840457, 0x00100413,
+                      0x00000013, 0x342024F3, 0x30501073, 0x00000073});
+    BasicCPU<VectorConfig> cpu(mem);
+    cpu.set_reg(6, 0xFFFFFFFF);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+    ASSERT_EQ(cpu.get_reg(6), 0u);
+    ASSERT_EQ(cpu.get_reg(7), 0x80000000u);
+    ASSERT_EQ(cpu.get_reg(8), 0u);
+    ASSERT_EQ(cpu.get_reg(9), BasicCPU<VectorConfig>::CAUSE_ILLEGAL_INSTRUCTION);
+}
+
+using AccessList = std::vector<std::pair<uint32_t, bool>>;
+using Geometry = std::tuple<uint32_t, uint32_t, uint32_t>; // Block size, sets, ways
+
+// Miss counts of Cache<Sets, Ways, BlockSize> replaying accesses, for each of Ways...
+template <uint32_t Sets, uint32_t BlockSize, uint32_t... Ways>
+void replay_ways(const AccessList& accesses, std::map<Geometry, uint64_t>& misses) {
+    auto replay = [&](auto cache) {
+        for (const auto& access : accesses) cache.access(access.first, access.second);
+        return cache.get_misses();
+    };
+    ((misses[Geometry{BlockSize, Sets, Ways}] = replay(Cache<Sets, Ways, BlockSize>{})), ...);
+}
+
+TEST(MemTraceTest, SweepMatchesCacheReplay) {
+    char path_template[] = "/tmp/mem_trace_XXXXXX";
+    int fd = mkstemp(path_template);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    std::string path = path_template;
+
+    // Strided sweeps with reuse, plus wild jumps that need the long encodings
+    AccessList accesses;
+    for (uint32_t pass = 0; pass < 3; ++pass) {
+        for (uint32_t a = 0; a < 0x3000; a += 4 + 12 * pass) accesses.push_back({a, pass == 1});
+        accesses.push_back({0xFFFFFFFC, false});
+        accesses.push_back({0x80000000 + pass, true});
+    }
+    {
+        MemTraceWriter writer;
+        ASSERT_TRUE(writer.open(path));
+        for (const auto& access : accesses) writer.record(access.first, access.second);
+        ASSERT_EQ(writer.get_count(), accesses.size());
+        ASSERT_LT(writer.get_bytes(), accesses.size() * 2); // Mostly one byte per access
+        ASSERT_TRUE(writer.close());
+    }
+    MemTraceReader reader;
+    ASSERT_TRUE(reader.open(path));
+    uint32_t address;
+    bool is_write;
+    for (const auto& access : accesses) {
+        ASSERT_TRUE(reader.next(address, is_write));
+        ASSERT_EQ(address, access.first);
+        ASSERT_EQ(is_write, access.second);
+    }
+    ASSERT_FALSE(reader.next(address, is_write));
+
+    // Every way count of a (sets, block size) pair in one pass, on two threads
+    std::vector<SweepResult> results;
+    std::string error;
+    ASSERT_TRUE(sweep_trace(path, {16, 64}, {16, 64}, 4, 2, results, error)) << error;
+    ASSERT_EQ(results.size(), 2u * 2 * 4);
+    std::map<Geometry, uint64_t> expected;
+    replay_ways<16, 16, 1, 2, 3, 4>(accesses, expected);
+    replay_ways<64, 16, 1, 2, 3, 4>(accesses, expected);
+    replay_ways<16, 64, 1, 2, 3, 4>(accesses, expected);
+    replay_ways<64, 64, 1, 2, 3, 4>(accesses, expected);
+    for (const SweepResult& r : results) {
+        ASSERT_EQ(r.accesses, accesses.size());
+        auto cache = expected.find(Geometry{r.block_size, r.sets, r.ways});
+        ASSERT_NE(cache, expected.end());
+        ASSERT_EQ(r.misses, cache->second) << r.block_size << "-byte blocks, " << r.sets << " sets, " << r.ways << " ways";
+    }
+    unlink(path.c_str());
+    ASSERT_FALSE(sweep_trace(path, {64}, {64}, 1, 1, results, error));
+}
+
+TEST(MemTraceTest, CoreRecordsDataCacheAccesses) {
+    // 1. addi x1, x0, 5
+    // 2. sw   x1, 0x100(x0)
+    // 3. lw   x2, 0x100(x0)
+    // 4. sb   x1, 0x203(x0)
+    // 5. ecall
+    char path_template[] = "/tmp/mem_trace_XXXXXX";
+    int fd = mkstemp(path_template);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    std::string path = path_template;
+
+    Memory mem;
+    mem.load_program({0x00500093, 0x10102023, 0x10002103, 0x201001A3, 0x00000073});
+    BasicCPU<MemTraceConfig> cpu(mem);
+    MemTraceWriter writer;
+    ASSERT_TRUE(writer.open(path));
+    cpu.set_mem_trace(&writer);
+    ASSERT_EQ(cpu.run(100), StopReason::Halted);
+    ASSERT_TRUE(writer.close());
+    ASSERT_EQ(writer.get_count(), cpu.get_cache_hits() + cpu.get_cache_misses());
+
+    MemTraceReader reader;
+    ASSERT_TRUE(reader.open(path));
+    const std::pair<uint32_t, bool> expected[] = {{0x100, true}, {0x100, false}, {0x203, true}};
+    uint32_t address;
+    bool is_write;
+    for (const auto& access : expected) {
+        ASSERT_TRUE(reader.next(address, is_write));
+        ASSERT_EQ(address, access.first);
+        ASSERT_EQ(is_write, access.second);
+    }
+    ASSERT_FALSE(reader.next(address, is_write));
+    unlink(path.c_str());
+}
+
+TEST(LsuTest, StoreBufferForwardsAndDrainsOnPartialOverlap) {
+    // 1.  lui x1, 0x1
+    // 2.  lui x2, 0x12345
+    // 3.  addi x2, x2, 0x678
+    // 4.  sw x2, 0(x1)
+    // 5.  lw x3, 0(x1)     ; Forwarded
+    // 6.  lbu x4, 2(x1)    ; Forwarded from part of the word
+    // 7.  addi x5, x0, 0xAB
+    // 8.  sb x5, 1(x1)
+    // 9.  lw x6, 0(x1)     ; The youngest match covers one byte: drain first
+    // 10. sw x2, 8(x1)     ; Still buffered when the program halts
+    // 11. ecall
+    Memory mem;
+    mem.load_program({0x000010B7, 0x12345137, 0x67810113, 0x0020A023, 0x0000A183, 0x0020C203, 0x0AB00293,
+                      0x005080A3, 0x0000A303, 0x0020A423, 0x00000073});
+    BasicCPU<LsuConfig> cpu(mem);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+    ASSERT_EQ(cpu.get_reg(3), 0x12345678u);
+    ASSERT_EQ(cpu.get_reg(4), 0x34u);
+    ASSERT_EQ(cpu.get_reg(6), 0x1234AB78u);
+    ASSERT_EQ(mem.read32(0x1008), 0x12345678u);
+    LsuStats stats = cpu.get_lsu_stats();
+    ASSERT_EQ(stats.forwarded_loads, 2u);
+    ASSERT_GT(stats.drain_stall_cycles, 0u);
+}
+
+TEST(LsuTest, MisalignedAccessesSplitOrTrap) {
+    // 1. lui x1, 0x1
+    // 2. lui x2, 0x12345
+    // 3. addi x2, x2, 0x678
+    // 4. sw x2, 1(x1)
+    // 5. lw x3, 1(x1)
+    // 6. lhu x4, 3(x1)
+    // 7. ecall
+    Memory mem;
+    mem.load_program({0x000010B7, 0x12345137, 0x67810113, 0x0020A0A3, 0x0010A183, 0x0030D203, 0x00000073});
+    CPU cpu(mem);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+    ASSERT_EQ(cpu.get_reg(3), 0x12345678u);
+    ASSERT_EQ(cpu.get_reg(4), 0x1234u);
+    ASSERT_EQ(mem.read8(0x1001), 0x78u);
+    ASSERT_EQ(cpu.get_lsu_stats().split_accesses, 3u);
+
+    // 1.  addi x10, x0, 24
+    // 2.  csrrw x0, mtvec, x10
+    // 3.  lui x1, 0x1
+    // 4.  lw x3, 2(x1)      ; Traps with misaligned_trap
+    // 5.  addi x8, x0, 1
+    // 6.  nop
+    // 7.  handler: csrr x11, mcause
+    // 8.  csrr x12, mtval
+    // 9.  csrrw x0, mtvec, x0
+    // 10. ecall
+    Memory trap_mem;
+    trap_mem.load_program({0x01800513, 0x30551073, 0x000010B7, 0x0020A183, 0x00100413, 0x00000013, 0x342025F3,
+                           0x34302673, 0x30501073, 0x00000073});
+    BasicCPU<LsuConfig> trap_cpu(trap_mem);
+    ASSERT_EQ(trap_cpu.run(1000), StopReason::Halted);
+    ASSERT_EQ(trap_cpu.get_reg(8), 0u);
+    ASSERT_EQ(trap_cpu.get_reg(11), BasicCPU<LsuConfig>::CAUSE_LOAD_MISALIGNED);
+    ASSERT_EQ(trap_cpu.get_reg(12), 0x1002u);
+}
+
+TEST(LsuTest, ReservedWidthsAreIllegal) {
+    // 1.  addi x5, x0, 28
+    // 2.  csrrw x0, mtvec, x5
+    // 3.  (ld x3, 0(x0))     ; LOAD funct3 3
+    // 4.  (sd x2, 0(x0))     ; STORE funct3 3
+    // 5.  csrrw x0, mtvec, x0
+    // 6.  ecall
+    // 7.  nop
+    // 8.  handler: csrr x9, mcause
+    // 9.  addi x10, x10, 1
+    // 10. csrr x11, mepc
+    // 11. addi x11, x11, 4
+    // 12. csrw mepc, x11
+    // 13. mret
+    Memory mem;
+    mem.load_program({0x01C00293, 0x30529073, 0x00003183, 0x00203023, 0x30501073, 0x00000073, 0x00000013,
+                      0x342024F3, 0x00150513, 0x341025F3, 0x00458593, 0x34159073, 0x30200073});
+    BasicCPU<LsuConfig> cpu(mem);
+    cpu.set_reg(3, 0xFFFFFFFF);
+    ASSERT_EQ(cpu.run(1000), StopReason::Halted);
+    ASSERT_EQ(cpu.get_reg(10), 2u);
+    ASSERT_EQ(cpu.get_reg(9), BasicCPU<LsuConfig>::CAUSE_ILLEGAL_INSTRUCTION);
+    ASSERT_EQ(cpu.get_reg(3), 0xFFFFFFFFu);
+}
+
+template <typename Config>
+uint32_t run_self_modifying(uint32_t barrier) {
+    // 1. lui x2, 0x200
+    // 2. addi x2, x2, 0x293  ; x2 = addi x5, x0, 2
+    // 3. sw x2, 16(x0)       ; Overwrite instruction 5
+    // 4. <barrier>
+    // 5. addi x5, x0, 1      ; Already fetched when the store reaches MEM
+    // 6. ecall
+    Memory mem;
+    mem.load_program({0x00200137, 0x29310113, 0x00202823, barrier, 0x00100293, 0x00000073});
+    BasicCPU<Config> cpu(mem);
+    cpu.run(1000);
+    return cpu.get_reg(5);
+}
+
+TEST(LsuTest, FenceIRefetchesModifiedCode) {
+    const uint32_t nop = 0x00000013, fence_i = 0x0000100F;
+    ASSERT_EQ(run_self_modifying<DefaultConfig>(nop), 1u);
+    ASSERT_EQ(run_self_modifying<DefaultConfig>(fence_i), 2u);
+    ASSERT_EQ(run_self_modifying<LsuConfig>(fence_i), 2u);
+}
+
+TEST(ArchTestSuite, VendoredSignaturesMatch) {
+    std::vector<ArchTest> tests = find_arch_tests("tests/arch");
+    ASSERT_FALSE(tests.empty());
+    for (const ArchTestResult& r : run_arch_tests(tests, std::thread::hardware_concurrency(), 1000000)) {
+        EXPECT_TRUE(r.passed) << r.name << ": " << r.detail;
+    }
+}
+
+TEST(ArchTestSuite, ReportsSignatureMismatch) {
+    char dir_template[] = "/tmp/arch_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    std::string dir = dir_template;
+    std::ifstream elf("tests/arch/rv32i-upper.elf", std::ios::binary);
+    std::ofstream(dir + "/upper.elf", std::ios::binary) << elf.rdbuf();
+    std::ofstream(dir + "/upper.reference_output") << "00000000\n00001000\n";
+
+    std::vector<ArchTest> tests = find_arch_tests(dir + "/upper.elf");
+    ASSERT_EQ(tests.size(), 1u);
+    ArchTestResult result = run_arch_test(tests[0], 1000000);
+    ASSERT_FALSE(result.passed);
+    ASSERT_NE(result.detail.find("reference 2"), std::string::npos);
+    ASSERT_GT(result.instret, 0u);
+
+    unlink((dir + "/upper.elf").c_str());
+    unlink((dir + "/upper.reference_output").c_str());
+    rmdir(dir.c_str());
+}
+
+TEST(CommandLineTest, ParseNumberRejectsTypos) {
+    uint64_t cycles = 7;
+    ASSERT_TRUE(parse_number("1000000", cycles));
+    ASSERT_EQ(cycles, 1000000u);
+    for (const char* bad : {"", "10k", "1e6", "-1", "+5", " 5", "0x10", "18446744073709551616"}) {
+        ASSERT_FALSE(parse_number(bad, cycles)) << bad;
+    }
+    ASSERT_EQ(cycles, 1000000u);
+
+    uint32_t sets = 0;
+    ASSERT_FALSE(parse_number("4294967296", sets)); // Past uint32_t
+    ASSERT_TRUE(parse_number("4294967295", sets));
+    ASSERT_EQ(sets, 4294967295u);
+}
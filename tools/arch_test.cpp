@@ -0,0 +1,72 @@
+// Signature-based architectural tests in the riscv-arch-test format
+// (make arch-test). Each test is an ELF linked into RAM (see
+// tests/arch/link.ld) whose results land between begin_signature and
+// end_signature, with a <name>.reference_output next to it. Every test runs
+// on its own core, spread over all host threads. Failures are listed, and
+// the summary gives the aggregate guest MIPS as a throughput check.
+//   bin/arch_test [--threads N] [--max-cycles N] [--verbose] <dir|test.elf>...
+#include "ArchTest.hpp"
+#include "CommandLine.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t max_cycles = 10000000;
+    bool verbose = false;
+    std::vector<std::string> paths;
+    bool usage_error = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            if (!parse_number(argv[++i], threads)) usage_error = true;
+        } else if (arg == "--max-cycles" && i + 1 < argc) {
+            if (!parse_number(argv[++i], max_cycles)) usage_error = true;
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else if (arg.rfind("--", 0) != 0) {
+            paths.push_back(arg);
+        } else {
+            usage_error = true;
+        }
+    }
+    if (usage_error || paths.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--threads N] [--max-cycles N] [--verbose] <dir|test.elf>..." << std::endl;
+        return 1;
+    }
+
+    std::vector<ArchTest> tests;
+    for (const std::string& path : paths) {
+        std::vector<ArchTest> found = find_arch_tests(path);
+        if (found.empty()) {
+            std::cerr << "Error: no tests with a .reference_output found in " << path << std::endl;
+            return 1;
+        }
+        tests.insert(tests.end(), found.begin(), found.end());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ArchTestResult> results = run_arch_tests(tests, threads, max_cycles);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    size_t passed = 0;
+    uint64_t instret = 0;
+    for (const ArchTestResult& r : results) {
+        passed += r.passed;
+        instret += r.instret;
+        if (!r.passed) {
+            std::cout << "FAIL " << r.name << ": " << r.detail << std::endl;
+        } else if (verbose) {
+            std::cout << "PASS " << r.name << " (" << r.instret << " instructions, " << r.cycles << " cycles)" << std::endl;
+        }
+    }
+    std::cout << passed << "/" << results.size() << " tests passed in " << std::fixed << std::setprecision(1)
+              << elapsed.count() * 1000.0 << " ms (" << std::setprecision(2) << instret / elapsed.count() / 1e6
+              << " guest MIPS, " << std::min<size_t>(threads, results.size()) << " threads)" << std::endl;
+    return passed == results.size() ? 0 : 1;
+}
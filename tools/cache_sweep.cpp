@@ -0,0 +1,73 @@
+// Offline data-cache design sweep over a trace recorded with
+// `emulator --config mem-trace --mem-trace <file>` (make cache-sweep).
+// Every block size and power-of-two set count is replayed at 1..max-ways ways
+// in one stack-distance pass, so the whole grid costs one read of the trace
+// per thread. Prints CSV, one LRU geometry per line.
+//   bin/cache_sweep [--block-sizes 16,32,64,128] [--max-sets N] [--max-ways N] [--threads N] <trace>
+#include "CacheSweep.hpp"
+#include "CommandLine.hpp"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static bool power_of_two(uint32_t value) {
+    return value && !(value & (value - 1));
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<uint32_t> block_sizes = {16, 32, 64, 128};
+    uint32_t max_sets = 4096;
+    uint32_t max_ways = 16;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string path;
+    bool usage_error = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--block-sizes" && i + 1 < argc) {
+            block_sizes.clear();
+            std::stringstream list(argv[++i]);
+            for (std::string item; std::getline(list, item, ',');) {
+                uint32_t size = 0;
+                if (!parse_number(item, size) || !power_of_two(size)) usage_error = true;
+                block_sizes.push_back(size);
+            }
+        } else if (arg == "--max-sets" && i + 1 < argc) {
+            if (!parse_number(argv[++i], max_sets) || !power_of_two(max_sets)) usage_error = true;
+        } else if (arg == "--max-ways" && i + 1 < argc) {
+            if (!parse_number(argv[++i], max_ways) || max_ways == 0) usage_error = true;
+        } else if (arg == "--threads" && i + 1 < argc) {
+            if (!parse_number(argv[++i], threads)) usage_error = true;
+        } else if (path.empty() && arg.rfind("--", 0) != 0) {
+            path = arg;
+        } else {
+            usage_error = true;
+        }
+    }
+    if (usage_error || path.empty() || block_sizes.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--block-sizes 16,32,64,128] [--max-sets N] [--max-ways N]"
+                  << " [--threads N] <trace>" << std::endl;
+        std::cerr << "Block sizes and --max-sets must be powers of two." << std::endl;
+        return 1;
+    }
+
+    std::vector<uint32_t> set_counts;
+    for (uint32_t sets = 1; sets <= max_sets; sets *= 2) set_counts.push_back(sets);
+
+    std::vector<SweepResult> results;
+    std::string error;
+    if (!sweep_trace(path, block_sizes, set_counts, max_ways, threads, results, error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+
+    std::cout << "block_size,sets,ways,capacity_bytes,accesses,misses,miss_rate" << std::endl;
+    for (const SweepResult& r : results) {
+        double miss_rate = r.accesses ? (double)r.misses / r.accesses : 0;
+        std::cout << r.block_size << "," << r.sets << "," << r.ways << "," << (uint64_t)r.block_size * r.sets * r.ways << ","
+                  << r.accesses << "," << r.misses << "," << miss_rate << std::endl;
+    }
+    return 0;
+}